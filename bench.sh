@@ -0,0 +1,163 @@
+#!/bin/bash
+#
+# Benchmarks of the translator options.
+#
+# Every section builds the BT with the option sets it compares (production
+# build with PRINT_STATISTICS, on top of the settings in Makedefs) and runs a
+# workload from bench/ under LD_PRELOAD of the BT. The number of translations
+# is taken from the statistics that the BT prints at exit, the peak RSS
+# (VmHWM) and times are printed by the workloads.
+#
+# usage: ./bench.sh [section...]
+#   sections  - threads clone calls translation warmup (default: all)
+#   THREADS   - thread counts of the threads section, default: 1 2 4 8 16 32 64
+#   CLONES    - threads created by the clone section, default: 100
+#   DEPTH     - recursion depth of the calls section, default: 32
+#   BENCH_CMD - large (IA32) binary for the translation and warmup sections,
+#               default: `/usr/bin/gcc --version'
+#
+# The results are written to bench_output.txt.
+
+set -e
+cd "$(dirname "$0")"
+
+SECTIONS=${*:-threads clone calls translation warmup}
+THREADS=${THREADS:-1 2 4 8 16 32 64}
+CLONES=${CLONES:-100}
+DEPTH=${DEPTH:-32}
+BENCH_CMD=${BENCH_CMD:-/usr/bin/gcc --version}
+OUT=bench_output.txt
+LIB=$PWD/src/$(sed -n 's/^IA32_LIBNAME = //p' Makedefs).so
+LOG=$(mktemp)
+trap 'rm -f $LOG' EXIT
+
+# builds the BT with the options "$1", returns non-zero if the build fails
+build() {
+  make -C src clean >/dev/null
+  CFLAGS="-DPRINT_STATISTICS $1" make -C src all DEBUG= PRODUCTION=1 \
+    >/dev/null 2>&1
+}
+
+# runs "$@" under the BT, the output goes to $LOG
+run_bt() {
+  env LD_PRELOAD="$LIB" "$@" >$LOG 2>&1 || true
+}
+
+# runs "$@" under the BT and prints its wall time in seconds
+time_bt() {
+  local TIMEFORMAT=%R
+  { time run_bt "$@"; } 2>&1
+}
+
+# prints the number of translated TUs of the last run: the shared count if the
+# code cache is shared, otherwise the sum of the mapping table entries of all
+# threads
+translations() {
+  awk '/TUs translated by all threads/ { if ($4 > shared) shared = $4 }
+       /^mappingtable: / { private += $4 }
+       END { print shared ? shared : private + 0 }' $LOG
+}
+
+# prints the value of the "name:" line of the last run
+result() {
+  awk -v name="$1:" '$1 == name { print $2 }' $LOG
+}
+
+# prints a table row: the first column is wide, the others are narrow
+row() {
+  printf "%-24s" "$1"
+  shift
+  printf " %12s" "$@"
+  printf "\n"
+}
+
+make -C bench all >/dev/null
+: >$OUT
+
+for section in $SECTIONS; do
+  case $section in
+  threads)
+    # translations and peak RSS against the number of threads
+    for config in "private code caches:" \
+                  "shared code cache:-DSHARED_DATA -DSHARED_CODE_CACHE"; do
+      name=${config%%:*}
+      if ! build "${config#*:}"; then
+        row "$name" "build failed"
+        continue
+      fi
+      row "$name" threads translations "VmHWM (kB)" "time (s)"
+      for n in $THREADS; do
+        run_bt bench/threads $n
+        row "" $n "$(translations)" "$(result VmHWM)" "$(result time)"
+      done
+    done
+    ;;
+  clone)
+    # latency from clone to the first instruction of the new thread
+    row "" "latency (us)" "VmHWM (kB)"
+    for config in "eager mapping table:" \
+                  "lazy mapping table:-DLAZY_MAPPINGTABLE"; do
+      name=${config%%:*}
+      if ! build "${config#*:}"; then
+        row "$name" "build failed"
+        continue
+      fi
+      run_bt bench/clone $CLONES
+      row "$name" "$(result latency)" "$(result VmHWM)"
+    done
+    ;;
+  calls)
+    # returns of call intensive code
+    row "" "time (s)"
+    bench/calls $DEPTH >$LOG 2>&1
+    row native "$(result time)"
+    for config in "return trampoline:" "return cache:-DRET_CACHE" \
+                  "shadow stack:-DSHADOW_STACK"; do
+      name=${config%%:*}
+      if ! build "${config#*:}"; then
+        row "$name" "build failed"
+        continue
+      fi
+      run_bt bench/calls $DEPTH
+      row "$name" "$(result time)"
+    done
+    ;;
+  translation)
+    # translation throughput of a large binary that exits right away
+    row "" translations "time (s)" "TUs/s"
+    for config in "direct translation:" "IR:-DTRANSLATION_IR"; do
+      name=${config%%:*}
+      if ! build "${config#*:}"; then
+        row "$name" "build failed"
+        continue
+      fi
+      t=$(time_bt $BENCH_CMD)
+      n=$(translations)
+      row "$name" $n $t \
+        "$(awk -v n=$n -v t=$t 'BEGIN { printf "%d", t > 0 ? n / t : 0 }')"
+    done
+    ;;
+  warmup)
+    # warm-up time of a large binary, with and without batches of targets
+    row "" "time (s)" translations
+    t=$( { TIMEFORMAT=%R; time $BENCH_CMD >/dev/null 2>&1; } 2>&1 )
+    row native $t
+    for config in "eager backpatching:-DEAGER_BACKPATCHING" \
+        "batch translation:-DEAGER_BACKPATCHING -DBATCH_TRANSLATION"; do
+      name=${config%%:*}
+      if ! build "${config#*:}"; then
+        row "$name" "build failed"
+        continue
+      fi
+      t=$(time_bt $BENCH_CMD)
+      row "$name" $t "$(translations)"
+    done
+    ;;
+  *)
+    echo "unknown section: $section"
+    exit 1
+    ;;
+  esac
+done 2>&1 | tee -a $OUT
+
+make -C src clean >/dev/null
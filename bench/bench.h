@@ -0,0 +1,63 @@
+/**
+ * @file bench.h
+ * Helpers shared by the benchmark workloads (see bench.sh). The workloads run
+ * natively or under LD_PRELOAD of the BT and print their results as
+ * "name: value" lines.
+ *
+ * Copyright (c) 2011 ETH Zurich
+ * @author Mathias Payer <mathias.payer@nebelwelt.net>
+ *
+ * $Date: 2011-12-30 14:24:05 +0100 (Fri, 30 Dec 2011) $
+ * $LastChangedDate: 2011-12-30 14:24:05 +0100 (Fri, 30 Dec 2011) $
+ * $LastChangedBy: payerm $
+ * $Revision: 1134 $
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301, USA.
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/** current time in seconds (monotonic clock) */
+static inline double bench_now() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * Prints the peak resident set size of the process (VmHWM), this includes the
+ * memory of the BT.
+ */
+static inline void bench_print_rss() {
+  char line[128];
+  FILE *status = fopen("/proc/self/status", "r");
+  if (status == NULL) {
+    return;
+  }
+  while (fgets(line, sizeof(line), status) != NULL) {
+    if (strncmp(line, "VmHWM:", 6) == 0) {
+      fputs(line, stdout);
+    }
+  }
+  fclose(status);
+}
+
+#endif  /* BENCH_H */
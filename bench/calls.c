@@ -0,0 +1,54 @@
+/**
+ * @file calls.c
+ * Call intensive workload: a recursive function whose leaves call a small
+ * helper. Almost all indirect jumps of this workload are returns.
+ *
+ * usage: calls <depth of the recursion>
+ *
+ * Copyright (c) 2011 ETH Zurich
+ * @author Mathias Payer <mathias.payer@nebelwelt.net>
+ *
+ * $Date: 2011-12-30 14:24:05 +0100 (Fri, 30 Dec 2011) $
+ * $LastChangedDate: 2011-12-30 14:24:05 +0100 (Fri, 30 Dec 2011) $
+ * $LastChangedBy: payerm $
+ * $Revision: 1134 $
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301, USA.
+ */
+
+#include <stdlib.h>
+
+#include "bench.h"
+
+static long __attribute__((noinline)) helper(long n) {
+  return n & 1;
+}
+
+static long __attribute__((noinline)) fib(long n) {
+  if (n < 2) {
+    return helper(n);
+  }
+  return fib(n - 1) + fib(n - 2);
+}
+
+int main(int argc, char **argv) {
+  long depth = argc > 1 ? atol(argv[1]) : 32;
+  double start = bench_now();
+  long result = fib(depth);
+  printf("result: %ld\n", result);
+  printf("time: %.3f s\n", bench_now() - start);
+  return 0;
+}
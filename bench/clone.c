@@ -0,0 +1,62 @@
+/**
+ * @file clone.c
+ * Thread creation workload: measures the time from pthread_create (the clone
+ * system call) to the first instruction of the new thread. The threads are
+ * created one after the other, so every thread pays for the initialization of
+ * its BT data (tld, mapping table, trampolines).
+ *
+ * usage: clone <number of threads>
+ *
+ * Copyright (c) 2011 ETH Zurich
+ * @author Mathias Payer <mathias.payer@nebelwelt.net>
+ *
+ * $Date: 2011-12-30 14:24:05 +0100 (Fri, 30 Dec 2011) $
+ * $LastChangedDate: 2011-12-30 14:24:05 +0100 (Fri, 30 Dec 2011) $
+ * $LastChangedBy: payerm $
+ * $Revision: 1134 $
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301, USA.
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "bench.h"
+
+/** time at the first instruction of the last thread */
+static double started;
+
+static void *first_instruction(void *arg __attribute__((unused))) {
+  started = bench_now();
+  return NULL;
+}
+
+int main(int argc, char **argv) {
+  long nr_threads = argc > 1 ? atol(argv[1]) : 100;
+  double latency = 0.0;
+  long i;
+  for (i = 0; i < nr_threads; ++i) {
+    pthread_t thread;
+    double start = bench_now();
+    pthread_create(&thread, NULL, first_instruction, NULL);
+    pthread_join(thread, NULL);
+    latency += started - start;
+  }
+  printf("threads: %ld\n", nr_threads);
+  printf("latency: %.1f us\n", latency / nr_threads * 1e6);
+  bench_print_rss();
+  return 0;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file threads.c
+ * Thread scaling workload: starts the given number of threads that all run
+ * the same mix of libc code (formatting, parsing, sorting). All threads are
+ * alive at the same time, so the peak RSS shows the memory of the BT per
+ * thread.
+ *
+ * usage: threads <number of threads>
+ *
+ * Copyright (c) 2011 ETH Zurich
+ * @author Mathias Payer <mathias.payer@nebelwelt.net>
+ *
+ * $Date: 2011-12-30 14:24:05 +0100 (Fri, 30 Dec 2011) $
+ * $LastChangedDate: 2011-12-30 14:24:05 +0100 (Fri, 30 Dec 2011) $
+ * $LastChangedBy: payerm $
+ * $Revision: 1134 $
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301, USA.
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "bench.h"
+
+static pthread_barrier_t barrier;
+
+static int compare(const void *a, const void *b) {
+  return *(const int*)a - *(const int*)b;
+}
+
+static void *worker(void *arg) {
+  char buf[128];
+  int values[256];
+  double sum = 0.0;
+  long i;
+  for (i = 0; i < 256; ++i) {
+    values[i] = (i * 7919) % 256;
+    snprintf(buf, sizeof(buf), "%ld %f %e %x %s", i, i / 3.0, i * 1e10,
+             (unsigned)i, "thread");
+    sum += strtod(buf + strlen(buf) / 2, NULL);
+  }
+  qsort(values, 256, sizeof(int), compare);
+  *(double*)arg = sum + values[0];
+  /* keep all threads (and their BT data) alive until every one is done */
+  pthread_barrier_wait(&barrier);
+  return NULL;
+}
+
+int main(int argc, char **argv) {
+  long nr_threads = argc > 1 ? atol(argv[1]) : 1;
+  pthread_t *threads = malloc(nr_threads * sizeof(pthread_t));
+  double *results = malloc(nr_threads * sizeof(double));
+  double start = bench_now();
+  long i;
+  pthread_barrier_init(&barrier, NULL, nr_threads);
+  for (i = 0; i < nr_threads; ++i) {
+    pthread_create(&threads[i], NULL, worker, &results[i]);
+  }
+  for (i = 0; i < nr_threads; ++i) {
+    pthread_join(threads[i], NULL);
+  }
+  printf("threads: %ld\n", nr_threads);
+  printf("time: %.3f s\n", bench_now() - start);
+  bench_print_rss();
+  return 0;
+}
@@ -203,6 +203,20 @@ typedef struct instr {
 #define		ST7						0x00000087
 
 
+/*******************************************************\
+ * eflags read and written by an instruction           *
+\*******************************************************/
+#define		EFLAGS_CF				0x01
+#define		EFLAGS_PF				0x02
+#define		EFLAGS_AF				0x04
+#define		EFLAGS_ZF				0x08
+#define		EFLAGS_SF				0x10
+#define		EFLAGS_OF				0x20
+#define		EFLAGS_DF				0x40
+#define		EFLAGS_STATUS			0x3F		/* CF, PF, AF, ZF, SF and OF */
+#define		EFLAGS_ALL				0x7F
+
+
 /*******************************************************\
  * instruction flags                                   *
 \*******************************************************/
@@ -33,6 +33,8 @@ std::string generateImplizitOperandString(const unsigned int implOperandFlags);
 std::string uppercase(const std::string &str);
 std::string imm2Flag(const unsigned int size);
 std::string flag2string(const unsigned int flags);
+unsigned int eflagsRead(const std::string &mnemonic);
+unsigned int eflagsWritten(const std::string &mnemonic);
 bool is_modrm_table (const instr_t * const table);
 bool is_fpu_table (const instr_t * const table);
 instr_t* getComplementFPUTable(const instr_t * const table);
@@ -310,7 +312,8 @@ void generateOpcodeTable(std::ofstream& out, const std::string &prefix, const st
 	} else {
 	    out << "{.handler = " << opcodeAction << "}, ";
 	}
-	out << "\"" << disasmInst.mnemonic << "\"";
+	out << "\"" << disasmInst.mnemonic << "\", ";
+	out << "0x" << std::hex << eflagsRead(disasmInst.mnemonic) << ", " << "0x" << std::hex << eflagsWritten(disasmInst.mnemonic);
 	//out << opcodeTable << ", " << opcodeAction;
 	if (opcodeIdx != length-1)
 	    out << " },\t/* " << opcodeComment << " */" << std::endl;
@@ -824,3 +827,107 @@ std::string flag2string(const unsigned int flags)
 }
 
 
+
+
+/* returns the condition code flags that are tested by a jcc, setcc, cmovcc or
+   fcmovcc with the given condition (the part of the mnemonic after the prefix) */
+static unsigned int conditionFlags(const std::string &cond)
+{
+    std::string c = cond;
+    if (c.length() > 1 && c[0] == 'n') c = c.substr(1);
+    if (c == "a" || c == "be") return EFLAGS_CF | EFLAGS_ZF;
+    if (c == "b" || c == "c") return EFLAGS_CF;
+    if (c == "e" || c == "z") return EFLAGS_ZF;
+    if (c == "g" || c == "le") return EFLAGS_ZF | EFLAGS_SF | EFLAGS_OF;
+    if (c == "ge" || c == "l") return EFLAGS_SF | EFLAGS_OF;
+    if (c == "o") return EFLAGS_OF;
+    if (c == "s") return EFLAGS_SF;
+    if (c == "p" || c == "pe" || c == "po" || c == "u") return EFLAGS_PF;
+    return 0;
+}
+
+static bool hasPrefix(const std::string &str, const std::string &prefix)
+{
+    return str.compare(0, prefix.length(), prefix) == 0;
+}
+
+/*
+ * eflags that are read by an instruction. Instructions that are not known to
+ * the translator (or that transfer control) read all flags, the liveness
+ * analysis must not look past them anyway.
+ */
+unsigned int eflagsRead(const std::string &mnemonic)
+{
+    const std::string &m = mnemonic;
+    if (m == "adc" || m == "sbb" || m == "rcl" || m == "rcr" || m == "cmc")
+	return EFLAGS_CF;
+    if (m == "daa" || m == "das")
+	return EFLAGS_CF | EFLAGS_AF;
+    if (m == "aaa" || m == "aas")
+	return EFLAGS_AF;
+    if (m == "into")
+	return EFLAGS_OF;
+    if (m == "loopz" || m == "loopnz")
+	return EFLAGS_ZF;
+    if (m == "lahf")
+	return EFLAGS_STATUS & ~EFLAGS_OF;
+    if (m == "pushfd" || m == "int" || m == "int3" || m == "iret" ||
+	m == "call" || m == "callf" || m == "ret" || m == "retf" ||
+	m == "jmp" || m == "jmpf" || m == "sysenter" || m == "")
+	return EFLAGS_ALL;
+    if (hasPrefix(m, "movs") || hasPrefix(m, "cmps") || hasPrefix(m, "scas") ||
+	hasPrefix(m, "lods") || hasPrefix(m, "stos") || hasPrefix(m, "ins") ||
+	hasPrefix(m, "outs")) {
+	/* movsd and cmpsd might as well be the sse instructions, reading the
+	   direction flag is the conservative choice */
+	if (m == "movss" || m == "movsx" || m == "movshdup" ||
+	    m == "movsldup" || m == "cmpss" || m == "insertps")
+	    return 0;
+	return EFLAGS_DF;
+    }
+    if (m[0] == 'j' && m != "jcxz")
+	return conditionFlags(m.substr(1));
+    if (hasPrefix(m, "set"))
+	return conditionFlags(m.substr(3));
+    if (hasPrefix(m, "cmov"))
+	return conditionFlags(m.substr(4));
+    if (hasPrefix(m, "fcmov"))
+	return conditionFlags(m.substr(5));
+    return 0;
+}
+
+/*
+ * eflags that are always overwritten by an instruction (undefined results
+ * count as written). Shifts and rotates leave the flags alone if the count is
+ * 0 and string compares might not be executed at all with a rep prefix, they
+ * do not kill any flags.
+ */
+unsigned int eflagsWritten(const std::string &mnemonic)
+{
+    const std::string &m = mnemonic;
+    if (m == "add" || m == "adc" || m == "sub" || m == "sbb" || m == "cmp" ||
+	m == "and" || m == "or" || m == "xor" || m == "test" || m == "neg" ||
+	m == "mul" || m == "imul" || m == "div" || m == "idiv" ||
+	m == "aaa" || m == "aas" || m == "aad" || m == "aam" || m == "daa" ||
+	m == "das" || m == "bsf" || m == "bsr" || m == "cmpxchg" ||
+	m == "xadd" || m == "popcnt" || m == "ptest" || m == "comisd" ||
+	m == "comiss" || m == "ucomisd" || m == "ucomiss" || m == "fcomi" ||
+	m == "fcomip" || m == "fucomi" || m == "fucomip")
+	return EFLAGS_STATUS;
+    if (m == "inc" || m == "dec")
+	return EFLAGS_STATUS & ~EFLAGS_CF;
+    if (m == "bt" || m == "bts" || m == "btr" || m == "btc")
+	return EFLAGS_STATUS & ~EFLAGS_ZF;
+    if (m == "cmpxch8b" || m == "lar" || m == "lsl" || m == "verr" ||
+	m == "verw" || m == "arpl")
+	return EFLAGS_ZF;
+    if (m == "sahf")
+	return EFLAGS_STATUS & ~EFLAGS_OF;
+    if (m == "clc" || m == "stc" || m == "cmc")
+	return EFLAGS_CF;
+    if (m == "cld" || m == "std")
+	return EFLAGS_DF;
+    if (m == "popfd")
+	return EFLAGS_ALL;
+    return 0;
+}
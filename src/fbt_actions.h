@@ -125,6 +125,15 @@ enum translation_state action_call(struct translate *ts);
  */
 enum translation_state action_call_indirect(struct translate *ts);
 
+/**
+ * Checks if a function is a get_pc thunk of PIC code (`movl (%esp), %reg;
+ * ret`, e.g., __x86.get_pc_thunk.bx).
+ * @param func start of the function
+ * @return the number of the register that the thunk loads, or -1 if the
+ * function is not a get_pc thunk
+ */
+long fbt_get_pc_thunk_reg(unsigned char *func);
+
 #elif defined(__arm__)
 enum translation_state action_branch(struct translate *ts);
 
@@ -39,7 +39,9 @@
 #include "fbt_mem_mgmt.h"
 #include "fbt_mem_pool.h"
 #include "fbt_syscall.h"
+#include "fbt_trace.h"
 #include "fbt_trampoline.h"
+#include "fbt_translate.h"
 #include "libfastbt.h"
 #if defined(__i386__)
 # include "ia32/fbt_asm_macros.h"
@@ -53,48 +55,349 @@ struct ccache_entry {
   ulong_t *dst;
 };
 
+/** entry of the fragment index */
+struct ccache_fragment {
+  /** start of the fragment in the code cache */
+  void *transl_start;
+  /** first byte after the fragment */
+  void *transl_end;
+  /** corresponding address in the original program */
+  void *orig;
+  /** guest code that the fragment was translated from (the fragment may
+      continue below orig and beyond its first page) */
+  void *orig_start;
+  void *orig_end;
+};
+
+/** the fragment index starts with this many pages and doubles if it is full */
+#define FRAGMENT_INDEX_PAGES 16
+
+/** size of the bitmap of guest pages that hold translated code */
+#define GUEST_PAGES_SIZE ((((ulong_t)-1) / PAGESIZE + 1) / 8)
+/** number of guest pages per word of the bitmap */
+#define GUEST_PAGES_PER_WORD (sizeof(ulong_t) * 8)
+
+#if defined(CCACHE_EVICTION)
+/** a direct jump from one fragment into another fragment */
+struct ccache_link {
+  /** location of the jump target in the code cache */
+  Code *origin;
+  /** addressing type of the origin */
+  enum origin_type origin_t;
+};
+
+/** the list of links starts with this many pages and doubles if it is full */
+#define LINKS_PAGES 16
+#endif  /* CCACHE_EVICTION */
+
+/** we grow the mapping table if it is more than half full */
+#define MAPPINGTABLE_MAX_LOAD(size) (MAPPINGTABLE_MAXENTRIES(size) / 2)
+/** we grow the mapping table if an insert needs more probes than this */
+#define MAPPINGTABLE_MAX_PROBE 32
+/** number of entries of the old table that are migrated on every insert */
+#define MAPPINGTABLE_MIGRATE_STEP 64
+
+/**
+ * Scans a table for orig_address, starting at the slot given by the hash.
+ * @param table the table to scan
+ * @param size size of the table in bytes
+ * @param orig_address address in the original program
+ * @param probes number of entries that we skipped (or NULL)
+ * @return the entry of orig_address or the free entry where the scan stopped
+ */
+static struct ccache_entry *table_scan(void *table, ulong_t size,
+                                       void *orig_address, ulong_t *probes) {
+  /* calculate offset into hashtable (this instruction is our hash function) */
+  ulong_t offset = C_MAPPING_FUNCTION((ulong_t)orig_address, size);
+  struct ccache_entry *entry = table + offset;
+  ulong_t count = 0;
+
+  while (entry->src != 0 && entry->src != orig_address) {
+    /* We mustn't access memory beyond the hashtable!!
+     * Bitwise AND with (size - 1) is the same as modulo size. */
+    offset = (offset + sizeof(struct ccache_entry)) & (size - 1);
+    entry = table + offset;
+    count++;
+    if (count >= MAPPINGTABLE_MAXENTRIES(size)) {
+      fbt_suicide_str("ERROR: mappingtable out of space (fbt_code_cache.c)\n");
+    }
+  }
+
+  if (probes != NULL) {
+    *probes = count;
+  }
+  return entry;
+}
+
+/**
+ * Fills in an entry of the current mapping table.
+ * @param mt the mapping table
+ * @param entry entry returned by table_scan
+ * @param probes length of the probe chain to that entry
+ * @param orig_address address in the original program
+ * @param transl_address pointer to the translated code fragment
+ */
+static void table_insert(struct mapping_table *mt, struct ccache_entry *entry,
+                         ulong_t probes, void *orig_address,
+                         void *transl_address) {
+  if (entry->src == 0) {
+    mt->nr_entries++;
+    mt->nr_probes += probes;
+    if (probes > mt->max_probe) {
+      mt->max_probe = probes;
+    }
+  }
+#if defined(SHARED_CODE_CACHE)
+  /* lookups in other threads match on src, so dst must be visible first */
+  entry->dst = transl_address;
+  __sync_synchronize();
+  entry->src = orig_address;
+#else
+  entry->src = orig_address;
+  entry->dst = transl_address;
+#endif  /* SHARED_CODE_CACHE */
+}
+
+/**
+ * Removes an entry from the current mapping table. The following entries of
+ * the probe chain are moved up, so that lookups never stop at the hole.
+ * @param mt the mapping table
+ * @param entry the entry to remove
+ */
+static void table_remove(struct mapping_table *mt, struct ccache_entry *entry) {
+  ulong_t mask = mt->size - 1;
+  ulong_t hole = (ulong_t)entry - (ulong_t)mt->table;
+  ulong_t next = (hole + sizeof(struct ccache_entry)) & mask;
+  struct ccache_entry *cur = mt->table + next;
+
+  while (cur->src != 0) {
+    ulong_t home = C_MAPPING_FUNCTION((ulong_t)cur->src, mt->size);
+    /* the entry may move into the hole if the hole is not before its home
+       bucket (on the way from home to the entry) */
+    if (((next - home) & mask) >= ((next - hole) & mask)) {
+      entry = mt->table + hole;
+#if defined(SHARED_CODE_CACHE)
+      /* lookups in other threads must never see the new dst with the old src,
+         a lookup that stops at the empty entry takes the locked slow path */
+      entry->src = 0;
+      __sync_synchronize();
+      entry->dst = cur->dst;
+      __sync_synchronize();
+      entry->src = cur->src;
+#else
+      entry->src = cur->src;
+      entry->dst = cur->dst;
+#endif  /* SHARED_CODE_CACHE */
+      hole = next;
+    }
+    next = (next + sizeof(struct ccache_entry)) & mask;
+    cur = mt->table + next;
+  }
+
+  entry = mt->table + hole;
+  entry->src = 0;
+  entry->dst = 0;
+  mt->nr_entries--;
+}
+
+/**
+ * Moves a couple of entries from the old into the current mapping table and
+ * releases the old table once it is empty.
+ * @param tld pointer to thread local data
+ * @param nr_entries number of entries of the old table that are checked
+ */
+static void migrate_entries(struct thread_local_data *tld, ulong_t nr_entries) {
+  struct mapping_table *mt = tld->mappingtable;
+
+  while (nr_entries-- > 0 && mt->migrate_offset < mt->old_size) {
+    struct ccache_entry *old = mt->old_table + mt->migrate_offset;
+    mt->migrate_offset += sizeof(struct ccache_entry);
+    if (old->src != 0) {
+      ulong_t probes;
+      struct ccache_entry *entry = table_scan(mt->table, mt->size, old->src,
+                                              &probes);
+      /* the entry might have been moved already by fbt_ccache_find */
+      if (entry->src == 0) {
+        table_insert(mt, entry, probes, old->src, old->dst);
+      }
+    }
+  }
+
+  if (mt->migrate_offset >= mt->old_size) {
+    PRINT_DEBUG("mappingtable %p migrated to %p", mt->old_table, mt->table);
+#if !defined(SHARED_CODE_CACHE)
+    fbt_lfree(tld, mt->old_table);
+#endif  /* !SHARED_CODE_CACHE */
+    /* other threads might still scan a shared table without holding the lock,
+       so we keep it mapped (the entries in there stay valid) */
+    mt->old_table = NULL;
+    mt->old_size = 0;
+    mt->migrate_offset = 0;
+  }
+}
+
+void fbt_ccache_finish_migration(struct thread_local_data *tld) {
+  struct mapping_table *mt = tld->mappingtable;
+  while (mt->old_table != NULL) {
+    migrate_entries(tld, MAPPINGTABLE_MAXENTRIES(mt->old_size));
+  }
+}
+
+/**
+ * Replaces the mapping table with a table of twice the size. The entries are
+ * moved over incrementally, see migrate_entries.
+ * @param tld pointer to thread local data
+ */
+static void grow_mappingtable(struct thread_local_data *tld) {
+  struct mapping_table *mt = tld->mappingtable;
+
+  /* finish the previous migration first */
+  fbt_ccache_finish_migration(tld);
+
+  PRINT_DEBUG("growing mappingtable: %d entries in %d slots, longest probe "
+              "chain %d", mt->nr_entries, MAPPINGTABLE_MAXENTRIES(mt->size),
+              mt->max_probe);
+
+  mt->old_table = mt->table;
+  mt->old_size = mt->size;
+  mt->migrate_offset = 0;
+
+  mt->size = mt->size << 1;
+  mt->table = fbt_allocate_mapping_table(tld, mt->size);
+  mt->nr_entries = 0;
+  mt->nr_probes = 0;
+  mt->max_probe = 0;
+  mt->nr_resizes++;
+
+#if defined(__i386__)
+  /* the lookup trampolines have the table address and the hash pattern baked
+     in (they do not exist yet while the first transaction is set up) */
+  if (tld->opt_ijump_trampoline != NULL) {
+    fbt_update_lookup_trampolines(tld);
+  }
+#endif  /* __i386__ */
+}
+
+/**
+ * Searches the fragment index for the last fragment that starts at or before
+ * transl_address.
+ * @param mt the mapping table that holds the index
+ * @param transl_address address in the code cache
+ * @return index of the fragment or -1 if all fragments start after the address
+ */
+static long fragment_search(struct mapping_table *mt, void *transl_address) {
+  long low = 0;
+  long high = (long)mt->nr_fragments - 1;
+  while (low <= high) {
+    long mid = (low + high) / 2;
+    if (mt->fragments[mid].transl_start <= transl_address) {
+      low = mid + 1;
+    } else {
+      high = mid - 1;
+    }
+  }
+  return high;
+}
+
+/**
+ * Adds an (empty) fragment to the fragment index. The code cache is filled
+ * from low to high addresses, so new fragments usually go to the end.
+ * @param tld pointer to thread local data
+ * @param orig_address address in the original program
+ * @param transl_address start of the fragment
+ */
+static void fragment_add(struct thread_local_data *tld, void *orig_address,
+                         void *transl_address) {
+  struct mapping_table *mt = tld->mappingtable;
+
+  if (mt->nr_fragments == mt->max_fragments) {
+    struct ccache_fragment *old = mt->fragments;
+    long pages = (mt->max_fragments == 0) ? FRAGMENT_INDEX_PAGES :
+      2 * NRPAGES(mt->max_fragments * sizeof(struct ccache_fragment));
+    mt->fragments = fbt_shared_lalloc(tld, pages, MT_INTERNAL);
+    mt->max_fragments = (pages * PAGESIZE) / sizeof(struct ccache_fragment);
+    if (old != NULL) {
+      fbt_memcpy(mt->fragments, old,
+                 mt->nr_fragments * sizeof(struct ccache_fragment));
+#if !defined(SHARED_CODE_CACHE)
+      fbt_lfree(tld, old);
+#endif  /* !SHARED_CODE_CACHE */
+    }
+  }
+
+  long pos = fragment_search(mt, transl_address) + 1;
+  /* the fragment might lie in a code cache below the current one */
+  long i;
+  for (i = mt->nr_fragments; i > pos; i--) {
+    mt->fragments[i] = mt->fragments[i - 1];
+  }
+  mt->fragments[pos].transl_start = transl_address;
+  mt->fragments[pos].transl_end = transl_address;
+  mt->fragments[pos].orig = orig_address;
+  mt->fragments[pos].orig_start = orig_address;
+  mt->fragments[pos].orig_end = (char*)orig_address + 1;
+  mt->nr_fragments++;
+}
+
 void *fbt_ccache_find(struct thread_local_data *tld, void *orig_address) {
   PRINT_DEBUG_FUNCTION_START("fbt_ccache_find(*tld=%p, *orig_address=%p)",
                              tld, orig_address);
 
   assert(tld != NULL);
 
-  /* calculate offset into hashtable (this instruction is our hash function) */
-  ulong_t offset = C_MAPPING_FUNCTION((ulong_t)orig_address);
+  struct mapping_table *mt = tld->mappingtable;
   ulong_t pos = 0;
-  struct ccache_entry *entry = tld->mappingtable + offset;
 
 #if defined(FBT_STATISTIC)
   fbt_nr_tcache_slow_lookups++;
 #endif
 
+#if defined(SHARED_CODE_CACHE)
+  /* the TU that is currently translated is not yet in the mapping table */
+  if (orig_address == tld->trans.tu_orig_address) {
+    PRINT_DEBUG_FUNCTION_END("-> %p", tld->trans.tu_transl_address);
+    return tld->trans.tu_transl_address;
+  }
+#endif  /* SHARED_CODE_CACHE */
+
   /* check entry if src address equals orig_address */
-  while (entry->src != 0) {
-    if (orig_address == entry->src) {
-      /* return corresponding dest address */
-      PRINT_DEBUG_FUNCTION_END("-> %p", entry->dst);
-      assert(entry->dst != NULL);
-      if (pos!=0) {
-        /* not optimal entry! swap suboptimal entry! */
-        void *tmp;
-        struct ccache_entry *firstentry = tld->mappingtable +
-          C_MAPPING_FUNCTION((ulong_t)orig_address);
-        tmp = firstentry->src;
-        firstentry->src = entry->src;
-        entry->src = tmp;
-        tmp = firstentry->dst;
-        firstentry->dst = entry->dst;
-        entry->dst = tmp;
-        entry = firstentry;
-      }
-      return entry->dst;
+  struct ccache_entry *entry = table_scan(mt->table, mt->size, orig_address,
+                                          &pos);
+  if (entry->src == orig_address) {
+    /* return corresponding dest address */
+    PRINT_DEBUG_FUNCTION_END("-> %p", entry->dst);
+    assert(entry->dst != NULL);
+#if !defined(SHARED_CODE_CACHE) && !defined(FAST_CACHE_LOOKUP)
+    /* the fast lookup scans the whole bucket (one cache line) in assembly, the
+       plain lookup only checks the first slot. other threads read the shared
+       table without locking and could see a half swapped entry, so we only
+       swap thread local tables */
+    if (pos!=0) {
+      /* not optimal entry! swap suboptimal entry! */
+      void *tmp;
+      struct ccache_entry *firstentry = mt->table +
+        C_MAPPING_FUNCTION((ulong_t)orig_address, mt->size);
+      tmp = firstentry->src;
+      firstentry->src = entry->src;
+      entry->src = tmp;
+      tmp = firstentry->dst;
+      firstentry->dst = entry->dst;
+      entry->dst = tmp;
+      entry = firstentry;
+    }
+#endif  /* !SHARED_CODE_CACHE && !FAST_CACHE_LOOKUP */
+    return entry->dst;
+  }
+
+  /* the entry might not be migrated yet, then we move it right away */
+  if (mt->old_table != NULL) {
+    struct ccache_entry *old = table_scan(mt->old_table, mt->old_size,
+                                          orig_address, NULL);
+    if (old->src == orig_address) {
+      PRINT_DEBUG_FUNCTION_END("-> %p (old table)", old->dst);
+      table_insert(mt, entry, pos, old->src, old->dst);
+      return old->dst;
     }
-    /* We mustn't access memory beyond the hashtable!!
-     * Bitwise AND with (HASHTABLE_SIZE - 1) is the same as
-     * modulo HASHTABLE_SIZE. */
-    offset = (offset + sizeof(struct ccache_entry)) & (MAPPINGTABLE_SIZE-1);
-    pos++;
-    entry = tld->mappingtable + offset;
   }
 
   PRINT_DEBUG_FUNCTION_END("-> %p", NULL);
@@ -106,11 +409,8 @@ void fbt_ccache_add_entry(struct thread_local_data *tld, void *orig_address,
   PRINT_DEBUG_FUNCTION_START("fbt_ccache_add_entry(*tld=%p, *orig_address=%p, "
                              "*transl_address=%p)", tld, orig_address,
                              transl_address);
-  /* calculate offset into hashtable that corresponds to this orig_address*/
-  ulong_t offset = C_MAPPING_FUNCTION((ulong_t) orig_address);
-  struct ccache_entry *entry = tld->mappingtable + offset;
-
-  int count = 0;
+  struct mapping_table *mt = tld->mappingtable;
+  ulong_t count = 0;
 
 #ifdef INLINE_CALLS
   if (tld->trans.inline_call_RIP != NULL) {
@@ -124,14 +424,16 @@ void fbt_ccache_add_entry(struct thread_local_data *tld, void *orig_address,
 #if defined(FBT_STATISTIC)
   fbt_nr_ccf++;
 #endif
-  /* search the hastable for a free position, beginning at offset */
-  while (entry->src != 0) {
-    offset = (offset + sizeof(struct ccache_entry)) & (MAPPINGTABLE_SIZE - 1);
-    entry = tld->mappingtable + offset;
-    count++;
-    if (count>=MAPPINGTABLE_MAXENTRIES/10) {
-      fbt_suicide_str("ERROR: mappingtable out of space (fbt_code_cache.c)\n");
-    }
+  /* search the hastable for a free position */
+  struct ccache_entry *entry = table_scan(mt->table, mt->size, orig_address,
+                                          &count);
+
+  /* grow the table instead of filling it up (and slowing down the lookups) */
+  if ((count > MAPPINGTABLE_MAX_PROBE ||
+       mt->nr_entries >= MAPPINGTABLE_MAX_LOAD(mt->size)) &&
+      mt->size < MAPPINGTABLE_MAX_SIZE) {
+    grow_mappingtable(tld);
+    entry = table_scan(mt->table, mt->size, orig_address, &count);
   }
 
 #if defined(FBT_STATISTIC)
@@ -161,15 +463,26 @@ void fbt_ccache_add_entry(struct thread_local_data *tld, void *orig_address,
   }
 #endif
   /* insert entry into hashtable */
-  entry->src = orig_address;
-  entry->dst = transl_address;
+  table_insert(mt, entry, count, orig_address, transl_address);
+  fragment_add(tld, orig_address, transl_address);
+
+  fbt_ccache_mark_guest(tld, orig_address, (char*)orig_address + 1);
   DUMP_JMP_TABLE_ENTRY(orig_address, transl_address);
+
+  if (mt->old_table != NULL) {
+    migrate_entries(tld, MAPPINGTABLE_MIGRATE_STEP);
+  }
   PRINT_DEBUG_FUNCTION_END(" ");
 
 }
 
 void fbt_ccache_flush(struct thread_local_data *tld) {
   PRINT_DEBUG_FUNCTION_START("fbt_ccache_flush(*tld=%p)", tld);
+#if defined(SHARED_CODE_CACHE)
+  /* other threads might execute in the code cache right now */
+  fbt_suicide_str("The shared code cache cannot be flushed "
+                  "(fbt_ccache_flush: fbt_code_cache.c)\n");
+#endif  /* SHARED_CODE_CACHE */
 #if defined(AUTHORIZE_SYSCALLS) && defined(HANDLE_SIGNAL)
   /* save signal handlers (trampolines will be removed in fbt_mem_free) */
   void *signal_handler_targets[MAX_NR_SIGNALS];
@@ -219,27 +532,539 @@ void fbt_ccache_flush(struct thread_local_data *tld) {
   PRINT_DEBUG_FUNCTION_END(" ");
 }
 
+void fbt_ccache_close_fragment(struct thread_local_data *tld,
+                               void *transl_address, void *transl_end,
+                               void *orig_start, void *orig_end) {
+  struct mapping_table *mt = tld->mappingtable;
+  long pos = fragment_search(mt, transl_address);
+  if (pos >= 0 && mt->fragments[pos].transl_start == transl_address) {
+    struct ccache_fragment *fragment = &mt->fragments[pos];
+    fragment->transl_end = transl_end;
+    if (orig_start < fragment->orig_start) {
+      fragment->orig_start = orig_start;
+    }
+    if (orig_end > fragment->orig_end) {
+      fragment->orig_end = orig_end;
+    }
+  }
+}
+
+void fbt_ccache_mark_guest(struct thread_local_data *tld, void *start,
+                           void *end) {
+  struct mapping_table *mt = tld->mappingtable;
+  if (mt->guest_pages == NULL) {
+    mt->guest_pages = fbt_shared_lalloc(tld, GUEST_PAGES_SIZE / PAGESIZE,
+                                        MT_INTERNAL);
+  }
+  /* an instruction spans at most two pages */
+  ulong_t page = (ulong_t)start / PAGESIZE;
+  ulong_t last = ((ulong_t)end - 1) / PAGESIZE;
+  mt->guest_pages[page / GUEST_PAGES_PER_WORD] |=
+    1UL << (page % GUEST_PAGES_PER_WORD);
+  if (last != page) {
+    mt->guest_pages[last / GUEST_PAGES_PER_WORD] |=
+      1UL << (last % GUEST_PAGES_PER_WORD);
+  }
+}
+
 void *fbt_ccache_find_reverse(struct thread_local_data *tld,
                               void *transl_address) {
   PRINT_DEBUG_FUNCTION_START("fbt_ccache_find_reverse(*tld=%p,"
                              " *transl_address=%p)", tld, transl_address);
-  struct ccache_entry *entry = tld->mappingtable;
-  struct ccache_entry *end = tld->mappingtable + MAPPINGTABLE_SIZE;
-  /* search the hastable for a free position, beginning at offset */
-  while (entry < end) {
-    if (entry->dst == transl_address) {
-      PRINT_DEBUG_FUNCTION_END("-> %p", entry->src);
-      return entry->src;
+  struct mapping_table *mt = tld->mappingtable;
+  long pos = fragment_search(mt, transl_address);
+  if (pos >= 0) {
+    struct ccache_fragment *fragment = &mt->fragments[pos];
+    /* entries outside the code cache (e.g., the commit function) are empty
+       fragments and only match their start */
+    if (fragment->transl_start == transl_address ||
+        transl_address < fragment->transl_end) {
+      PRINT_DEBUG_FUNCTION_END("-> %p", fragment->orig);
+      return fragment->orig;
     }
-    entry++;
   }
   PRINT_DEBUG_FUNCTION_END("-> %p", NULL);
   return NULL;
 }
 
+/**
+ * Checks if any of the pages of a range holds translated code and optionally
+ * clears the pages in the bitmap of guest pages.
+ * @param mt the mapping table
+ * @param start start of the range (page aligned)
+ * @param len length of the range
+ * @param clear clear the pages if set, otherwise stop at the first one
+ * @return 1 if code in the range was translated, 0 otherwise
+ */
+static int guest_pages_test(struct mapping_table *mt, void *start,
+                            ulong_t len, int clear) {
+  if (mt->guest_pages == NULL || len == 0) {
+    return 0;
+  }
+  ulong_t page = (ulong_t)start / PAGESIZE;
+  ulong_t last = ((ulong_t)start + len - 1) / PAGESIZE;
+  if (last < page) {
+    /* the range wraps around */
+    last = ((ulong_t)-1) / PAGESIZE;
+  }
+  int found = 0;
+  while (page <= last) {
+    ulong_t *word = &mt->guest_pages[page / GUEST_PAGES_PER_WORD];
+    if (*word == 0) {
+      /* skip the whole word */
+      page = (page | (GUEST_PAGES_PER_WORD - 1)) + 1;
+      continue;
+    }
+    ulong_t bit = 1UL << (page % GUEST_PAGES_PER_WORD);
+    if (*word & bit) {
+      if (!clear) {
+        return 1;
+      }
+      *word &= ~bit;
+      found = 1;
+    }
+    page++;
+  }
+  return found;
+}
+
+long fbt_ccache_has_guest(struct thread_local_data *tld, void *start,
+                          ulong_t len) {
+  ulong_t offset = (ulong_t)start % PAGESIZE;
+  return guest_pages_test(tld->mappingtable, (char*)start - offset,
+                          len + offset, 0);
+}
+
+void fbt_ccache_invalidate(struct thread_local_data *tld, void *start,
+                           ulong_t len) {
+  PRINT_DEBUG_FUNCTION_START("fbt_ccache_invalidate(*tld=%p, *start=%p, "
+                             "len=%d)", tld, start, len);
+#if defined(JUMP_TABLES)
+  /* translated jump tables rely on the table of the program, if it may change
+     then the jump table dispatches through the table of the program */
+  struct jump_table *jt;
+  if (OVERLAPPING_REGIONS(start, len, tld->readonly_map_start,
+                          tld->readonly_map_end - tld->readonly_map_start)) {
+    tld->readonly_map_start = 0;
+    tld->readonly_map_end = 0;
+  }
+  for (jt = tld->jump_tables; jt != NULL; jt = jt->next) {
+    if (PTR_IN_REGION(jt->table, start, len) ||
+        PTR_IN_REGION(start, jt->table, jt->nr_entries * sizeof(ulong_t))) {
+      ulong_t i;
+      for (i = 0; i < jt->nr_entries; ++i) {
+        jt->transl[i] = jt->fallback;
+      }
+    }
+  }
+#endif  /* JUMP_TABLES */
+
+  /* the bitmap of guest pages only knows whole pages, the fragments must be
+     checked against the same pages */
+  ulong_t offset = (ulong_t)start % PAGESIZE;
+  start = (char*)start - offset;
+  len = (len + offset + PAGESIZE - 1) & ~(PAGESIZE - 1);
+
+  struct mapping_table *mt = tld->mappingtable;
+  if (!guest_pages_test(mt, start, len, 1)) {
+    PRINT_DEBUG_FUNCTION_END("-> no translated code");
+    return;
+  }
+
+  fbt_ccache_finish_migration(tld);
+  ulong_t i, nr_invalidated = 0;
+  for (i = 0; i < mt->nr_fragments; ++i) {
+    struct ccache_fragment *fragment = &mt->fragments[i];
+    if (!PTR_IN_REGION(fragment->orig_start, start, len) &&
+        !PTR_IN_REGION(start, fragment->orig_start,
+                       (ulong_t)fragment->orig_end -
+                       (ulong_t)fragment->orig_start)) {
+      continue;
+    }
+    /* the fragment might be stale already */
+    struct ccache_entry *entry = table_scan(mt->table, mt->size,
+                                            fragment->orig, NULL);
+    if (entry->src != fragment->orig ||
+        entry->dst != fragment->transl_start) {
+      continue;
+    }
+    table_remove(mt, entry);
+    /* empty fragments are entries outside of the code cache (e.g., the commit
+       function), there is no code to patch */
+    if (fragment->transl_start == fragment->transl_end) {
+      continue;
+    }
+
+    /* direct jumps, predictions, and fall-throughs into the fragment reach the
+       new translation through a trampoline at the start of the fragment */
+    Code *code = fragment->transl_start;
+#if defined(__i386__)
+    struct trampoline *trampo = fbt_create_trampoline(tld, fragment->orig,
+                                                      code + 1,
+                                                      ORIGIN_RELATIVE);
+    JMP_REL32(code, (ulong_t)trampo->code);
+#elif defined(__arm__)
+    struct trampoline *trampo = fbt_create_trampoline(tld, fragment->orig,
+                                                      NULL, ORIGIN_CLEAR);
+    GEN_B_ABS(code, trampo->code);
+#endif
+    nr_invalidated++;
+  }
+  PRINT_DEBUG_FUNCTION_END("-> %d fragments invalidated", nr_invalidated);
+}
+
+#if defined(CCACHE_EVICTION)
+void fbt_ccache_add_link(struct thread_local_data *tld, void *origin,
+                         enum origin_type origin_t) {
+  if (tld->nr_links == tld->max_links) {
+    struct ccache_link *old = tld->links;
+    long pages = (tld->max_links == 0) ? LINKS_PAGES :
+      2 * NRPAGES(tld->max_links * sizeof(struct ccache_link));
+    tld->links = fbt_lalloc(tld, pages, MT_INTERNAL);
+    tld->max_links = (pages * PAGESIZE) / sizeof(struct ccache_link);
+    if (old != NULL) {
+      fbt_memcpy(tld->links, old, tld->nr_links * sizeof(struct ccache_link));
+      fbt_lfree(tld, old);
+    }
+  }
+  tld->links[tld->nr_links].origin = origin;
+  tld->links[tld->nr_links].origin_t = origin_t;
+  tld->nr_links++;
+}
+
+/**
+ * Returns the target of a jump in the code cache.
+ * @param origin location of the jump target
+ * @param origin_t addressing type of the origin
+ * @return the target of the jump
+ */
+static void *link_target(Code *origin, enum origin_type origin_t) {
+  if (origin_t == ORIGIN_RELATIVE) {
+    return (void*)((ulong_t)origin + 4 + *(int32_t*)origin);
+  }
+  return (void*)*(ulong_t*)origin;
+}
+
+/**
+ * Redirects a jump to a new trampoline for target.
+ * @param tld pointer to thread local data
+ * @param origin location of the jump target
+ * @param origin_t addressing type of the origin
+ * @param target address in the original program
+ */
+static void unlink_origin(struct thread_local_data *tld, Code *origin,
+                          enum origin_type origin_t, void *target) {
+  struct trampoline *trampo = fbt_create_trampoline(tld, target, origin,
+                                                    origin_t);
+  if (origin_t == ORIGIN_RELATIVE) {
+    *(uint32_t*)origin = (uint32_t)((ulong_t)trampo->code -
+                                    (ulong_t)origin - 4);
+  } else {
+    *(uint32_t*)origin = (uint32_t)(trampo->code);
+  }
+}
+
+/**
+ * Evicts a chunk of the code cache: removes its fragments from the mapping
+ * table and from the fragment index, redirects jumps from other fragments into
+ * the chunk to trampolines, frees trampolines and predictions that belong to
+ * the chunk, and unmaps the chunk.
+ * @param tld pointer to thread local data
+ * @param start start of the chunk
+ */
+static void evict_chunk(struct thread_local_data *tld, void *start) {
+  struct mapping_table *mt = tld->mappingtable;
+  ulong_t size = CODE_CACHE_ALLOC_PAGES * PAGESIZE;
+  void *end = start + size;
+  PRINT_DEBUG("evicting code cache chunk %p -> %p", start, end);
+
+  /* jumps into the chunk go through trampolines again (this needs the
+     fragment index), jumps out of the chunk are forgotten */
+  ulong_t i, nr_links = 0;
+  for (i = 0; i < tld->nr_links; ++i) {
+    struct ccache_link *link = &tld->links[i];
+    if (PTR_IN_REGION(link->origin, start, size)) {
+      continue;
+    }
+    void *transl = link_target(link->origin, link->origin_t);
+    if (PTR_IN_REGION(transl, start, size)) {
+      void *target = fbt_ccache_find_reverse(tld, transl);
+      assert(target != NULL);
+      unlink_origin(tld, link->origin, link->origin_t, target);
+      continue;
+    }
+    tld->links[nr_links++] = *link;
+  }
+  tld->nr_links = nr_links;
+
+  /* entries of the mapping table and the fragment index (the fragments of the
+     chunk are next to each other in the index) */
+  fbt_ccache_finish_migration(tld);
+  long first = fragment_search(mt, start);
+  if (first < 0 || mt->fragments[first].transl_start < start) {
+    first++;
+  }
+  long last = fragment_search(mt, end - 1);
+  long pos;
+  for (pos = first; pos <= last; ++pos) {
+    struct ccache_fragment *fragment = &mt->fragments[pos];
+    struct ccache_entry *entry = table_scan(mt->table, mt->size,
+                                            fragment->orig, NULL);
+    if (entry->src == fragment->orig &&
+        entry->dst == fragment->transl_start) {
+      table_remove(mt, entry);
+    }
+  }
+  if (last >= first) {
+    for (pos = last + 1; pos < (long)mt->nr_fragments; ++pos) {
+      mt->fragments[pos - (last - first + 1)] = mt->fragments[pos];
+    }
+    mt->nr_fragments -= last - first + 1;
+  }
+
+  /* trampolines that would backpatch the chunk and predictions that live in
+     the chunk or predict a target in the chunk */
+  struct mem_info *chunk;
+  for (chunk = tld->chunk; chunk != NULL; chunk = chunk->next) {
+    if (chunk->type == MT_TRAMPOLINE) {
+      struct trampoline *trampo = chunk->ptr;
+      struct trampoline *trampo_end = chunk->ptr + chunk->size;
+      for (; trampo + 1 <= trampo_end; ++trampo) {
+        if (PTR_IN_REGION(trampo->origin, start, size)) {
+          fbt_trampoline_free(tld, trampo);
+        }
+      }
+    }
+#if defined(ICF_PREDICT)
+    if (chunk->type == MT_ICF_PREDICT) {
+      struct icf_prediction *pred = chunk->ptr;
+      struct icf_prediction *pred_end = chunk->ptr + chunk->size;
+      for (; pred + 1 <= pred_end; ++pred) {
+        if (pred->origin[0] == NULL) {
+          continue;
+        }
+        if (PTR_IN_REGION(pred->pred.src, start, size)) {
+          fbt_icf_predictor_free(tld, pred);
+          continue;
+        }
+        long way;
+        for (way = 0; way < ICF_PREDICT_WAYS; ++way) {
+          if (PTR_IN_REGION(link_target((Code*)pred->dst[way],
+                                        ORIGIN_RELATIVE), start, size)) {
+            /* no guest address is 0, the next execution mispredicts */
+            *(pred->origin[way]) = 0x0;
+          }
+        }
+      }
+    }
+#endif  /* ICF_PREDICT */
+#if defined(RET_CACHE)
+    if (chunk->type == MT_RET_CACHE) {
+      struct ret_cache *cache = chunk->ptr;
+      struct ret_cache *cache_end = chunk->ptr + chunk->size;
+      for (; cache + 1 <= cache_end; ++cache) {
+        if (PTR_IN_REGION(cache->miss, start, size)) {
+          /* the ret instruction is evicted, the cache is not used again */
+          cache->miss = NULL;
+        }
+        long entry;
+        for (entry = 0; entry < RET_CACHE_ENTRIES; ++entry) {
+          if (PTR_IN_REGION(cache->entries[entry].transl, start, size)) {
+            cache->entries[entry].ret = 0x0;
+          }
+        }
+      }
+    }
+#endif  /* RET_CACHE */
+  }
+
+  fbt_lfree(tld, start);
+}
+
+void fbt_ccache_evict(struct thread_local_data *tld) {
+#if defined(SHADOW_STACK)
+  if (tld->ccache_nr_chunks > CCACHE_MAX_CHUNKS) {
+    /* entries of the shadow stack might point into the evicted chunks */
+    fbt_memset(tld->shadow_stack, 0, sizeof(tld->shadow_stack));
+  }
+#endif  /* SHADOW_STACK */
+  while (tld->ccache_nr_chunks > CCACHE_MAX_CHUNKS) {
+    /* FIFO, the first chunk holds the trampolines */
+    evict_chunk(tld, tld->ccache_chunks[1]);
+    long i;
+    for (i = 1; i < tld->ccache_nr_chunks - 1; ++i) {
+      tld->ccache_chunks[i] = tld->ccache_chunks[i + 1];
+    }
+    tld->ccache_nr_chunks--;
+  }
+}
+#endif  /* CCACHE_EVICTION */
+
+void fbt_ccache_print_statistics(struct thread_local_data *tld) {
+  struct mapping_table *mt = tld->mappingtable;
+  ulong_t slots = MAPPINGTABLE_MAXENTRIES(mt->size);
+  llprintf("mappingtable: %d KB, %d of %d entries used (load %d%%), grown %d "
+           "times\n", mt->size >> 10, mt->nr_entries, slots,
+           (mt->nr_entries * 100) / slots, mt->nr_resizes);
+  /* llprintf has no floats, print the average with one decimal */
+  ulong_t avg = mt->nr_entries ? (mt->nr_probes * 10) / mt->nr_entries : 0;
+  llprintf("mappingtable probes: %d.%d on average, %d at most\n", avg / 10,
+           avg % 10, mt->max_probe);
+
+#if defined(ICF_PREDICT)
+  static const char *state_names[] = { "predicting", "megamorphic",
+                                       "profiling" };
+  ulong_t nr_states[3] = { 0, 0, 0 };
+  ulong_t nr_rearms = 0;
+#if defined(SHARED_CODE_CACHE)
+  struct mem_info *chunk = tld->shared_data->chunk;
+#else
+  struct mem_info *chunk = tld->chunk;
+#endif  /* SHARED_CODE_CACHE */
+  for (; chunk != NULL; chunk = chunk->next) {
+    if (chunk->type != MT_ICF_PREDICT) {
+      continue;
+    }
+    struct icf_prediction *pred = chunk->ptr;
+    struct icf_prediction *pred_end = chunk->ptr + chunk->size;
+    for (; pred + 1 <= pred_end; ++pred) {
+      if (pred->origin[0] == NULL) {
+        /* unused prediction */
+        continue;
+      }
+      ulong_t nr_targets = 0;
+      long i;
+      for (i = 0; i < ICF_PREDICT_WAYS; ++i) {
+        if (*(pred->origin[i]) != 0x0) {
+          nr_targets++;
+        }
+      }
+      PRINT_DEBUG("prediction at %p: %s, %d targets, %d mispredictions, "
+                  "sample period %d, re-armed %d times\n", pred->pred.src,
+                  state_names[pred->state], nr_targets, pred->nrmispredict,
+                  pred->period, pred->nrrearms);
+      nr_states[pred->state]++;
+      nr_rearms += pred->nrrearms;
+    }
+  }
+  llprintf("predictions: %d %s, %d %s, %d %s, re-armed %d times\n",
+           nr_states[ICF_PREDICTING], state_names[ICF_PREDICTING],
+           nr_states[ICF_MEGAMORPHIC], state_names[ICF_MEGAMORPHIC],
+           nr_states[ICF_PROFILING], state_names[ICF_PROFILING], nr_rearms);
+#endif  /* ICF_PREDICT */
+}
+
+#if defined(EAGER_BACKPATCHING)
+/**
+ * Returns the bucket of the table of pending trampolines for a target.
+ * @param tld thread local data
+ * @param target IP in the untranslated code
+ * @return the head of the list of pending trampolines in the bucket
+ */
+static struct trampoline **pending_bucket(struct thread_local_data *tld,
+                                          void *target) {
+  ulong_t hash = (ulong_t)target ^ ((ulong_t)target >> 10);
+  return &tld->trans.pending_trampos[hash & (PENDING_TRAMPOLINES_SIZE - 1)];
+}
+
+/**
+ * Links a jump that leads to a trampoline to the translated target.
+ * @param origin location of the jump target in the code cache
+ * @param origin_t addressing type of the origin
+ * @param trampo the trampoline
+ * @param transl_target translation of the target of the trampoline
+ * @return 1 if the jump was linked, 0 if it does not lead to the trampoline
+ * any more (e.g., the entries of an invalidated jump table)
+ */
+static long link_origin(Code *origin, enum origin_type origin_t,
+                        struct trampoline *trampo, void *transl_target) {
+  uint32_t *jump = (uint32_t*)origin;
+  if (origin_t == ORIGIN_RELATIVE) {
+    if ((ulong_t)jump + 4 + *jump != (ulong_t)trampo->code) {
+      return 0;
+    }
+    *jump = (uint32_t)((ulong_t)transl_target - (ulong_t)jump - 4);
+  } else {
+    if (*jump != (uint32_t)trampo->code) {
+      return 0;
+    }
+    *jump = (uint32_t)transl_target;
+  }
+  return 1;
+}
+#endif  /* EAGER_BACKPATCHING */
+
+#if defined(TRAMPOLINE_SHARING)
+/**
+ * Returns a pending trampoline that a new jump to target can share.
+ * @param tld thread local data
+ * @param target IP in the untranslated code
+ * @param origin location of the target of the new jump
+ * @param origin_t addressing type of the origin
+ * @return the trampoline or NULL if the jump needs a trampoline of its own
+ */
+static struct trampoline *find_shared_trampoline(struct thread_local_data *tld,
+                                                 void *target, void *origin,
+                                                 enum origin_type origin_t) {
+  if (origin == NULL ||
+      (origin_t != ORIGIN_RELATIVE && origin_t != ORIGIN_ABSOLUTE)) {
+    return NULL;
+  }
+#if defined(HOT_TRACES)
+  /* the recording of a trace needs to know which exit of the trace is taken,
+     so exits of traces keep their own trampolines */
+  struct trace_cache *tc = tld->traces;
+  if (tld->trans.in_trace) {
+    return NULL;
+  }
+#endif  /* HOT_TRACES */
+
+  struct trampoline *trampo = *pending_bucket(tld, target);
+  for (; trampo != NULL; trampo = trampo->pending) {
+    if (trampo->target != target) {
+      continue;
+    }
+#if defined(HOT_TRACES)
+    if (tc != NULL &&
+        PTR_IN_REGION(trampo->origin, tc->base, tc->code_end - tc->base)) {
+      continue;
+    }
+#endif  /* HOT_TRACES */
+    return trampo;
+  }
+  return NULL;
+}
+#endif  /* TRAMPOLINE_SHARING */
+
 struct trampoline *fbt_create_trampoline(struct thread_local_data *tld,
                                          void *call_target, void *origin,
                                          enum origin_type origin_t) {
+#if defined(TRAMPOLINE_SHARING)
+  /* jumps to the same untranslated target share a trampoline */
+  struct trampoline *shared = find_shared_trampoline(tld, call_target, origin,
+                                                     origin_t);
+  if (shared != NULL) {
+    if (tld->trans.free_origins == NULL) {
+      fbt_allocate_new_trampoline_origins(tld);
+    }
+    struct trampoline_origin *other = tld->trans.free_origins;
+    tld->trans.free_origins = other->next;
+
+    /* the new jump becomes the origin of the trampoline, translate_execute
+       continues in place if the last jump of the current TU is taken */
+    other->origin = shared->origin;
+    other->origin_t = shared->origin_t;
+    other->next = shared->origins;
+    shared->origins = other;
+    shared->origin = origin;
+    shared->origin_t = origin_t;
+
+    PRINT_DEBUG("shared trampoline: %p, target: %p, origin: %p", shared,
+                shared->target, shared->origin);
+    return shared;
+  }
+#endif  /* TRAMPOLINE_SHARING */
+
   if (tld->trans.trampos == NULL) {
     fbt_allocate_new_trampolines(tld);
   }
@@ -250,6 +1075,29 @@ struct trampoline *fbt_create_trampoline(struct thread_local_data *tld,
   trampos->target = call_target;
   trampos->origin = origin;
   trampos->origin_t = origin_t;
+#if defined(TRAMPOLINE_SHARING)
+  trampos->origins = NULL;
+#endif  /* TRAMPOLINE_SHARING */
+
+#if defined(EAGER_BACKPATCHING)
+  /* jumps to code that is not translated yet are linked as soon as the target
+     is translated, even if they are never taken */
+  if (origin != NULL &&
+      (origin_t == ORIGIN_RELATIVE || origin_t == ORIGIN_ABSOLUTE) &&
+      fbt_ccache_find(tld, call_target) == NULL) {
+    struct trampoline **bucket = pending_bucket(tld, call_target);
+    trampos->pending = *bucket;
+    *bucket = trampos;
+#if defined(BATCH_TRANSLATION)
+#if defined(HOT_TRACES)
+    if (!tld->trans.in_trace)
+#endif  /* HOT_TRACES */
+    fbt_queue_speculative(tld, call_target);
+#endif  /* BATCH_TRANSLATION */
+  } else {
+    trampos->pending = TRAMPOLINE_UNTRACKED;
+  }
+#endif  /* EAGER_BACKPATCHING */
 
   Code *code = (Code *)&(trampos->code);
 
@@ -257,7 +1105,16 @@ struct trampoline *fbt_create_trampoline(struct thread_local_data *tld,
               trampos->target, trampos->origin);
 
   /* write code to trampoline */
-#if defined(__i386__)
+#if defined(__i386__) && defined(SHARED_CODE_CACHE)
+  /* movl %esp, %fs:-4 (7 bytes long) */
+  TLD_SEGMENT_PREFIX(code);
+  MOV_ESP_MEM32(code, TLD_STACK_M32(tld, 1));
+  /* movl %fs:stack, %esp; leal -4(%esp), %esp (11 bytes long) */
+  TLD_SEGMENT_PREFIX(code);
+  MOVL_IMM32RM32_R32(code, 0x25, TLD_FIELD_M32(tld, stack));
+  LEAL_IMM8RM32_R(code, 0x64, 0x24, -4);
+  CALL_REL32(code, tld->unmanaged_code_trampoline); /* 5 bytes long */
+#elif defined(__i386__)
   MOV_ESP_MEM32(code, (tld->stack - 1));  /* 6 bytes long */
   MOV_IMM32_ESP(code, (tld->stack - 1));  /* 5 bytes long */
   CALL_REL32(code, tld->unmanaged_code_trampoline); /* 5 bytes long */
@@ -268,3 +1125,73 @@ struct trampoline *fbt_create_trampoline(struct thread_local_data *tld,
 
   return trampos;
 }
+
+#if defined(EAGER_BACKPATCHING)
+void fbt_link_pending_trampolines(struct thread_local_data *tld, void *target,
+                                  void *transl_target) {
+  struct trampoline **link = pending_bucket(tld, target);
+  while (*link != NULL) {
+    struct trampoline *trampo = *link;
+    if (trampo->target != target) {
+      link = &trampo->pending;
+      continue;
+    }
+    *link = trampo->pending;
+    trampo->pending = TRAMPOLINE_UNTRACKED;
+
+#if defined(TRAMPOLINE_SHARING)
+    fbt_link_shared_origins(tld, trampo, transl_target);
+#endif  /* TRAMPOLINE_SHARING */
+    /* the jump might have been redirected in the meantime, then the
+       trampoline is left alone */
+    if (!link_origin(trampo->origin, trampo->origin_t, trampo,
+                     transl_target)) {
+      continue;
+    }
+    PRINT_DEBUG("linked pending trampoline %p (origin: %p) to %p", trampo,
+                trampo->origin, transl_target);
+    fbt_trampoline_free(tld, trampo);
+  }
+}
+
+void fbt_untrack_trampoline(struct thread_local_data *tld,
+                            struct trampoline *trampo) {
+  if (trampo->pending == TRAMPOLINE_UNTRACKED) {
+    return;
+  }
+  struct trampoline **link = pending_bucket(tld, trampo->target);
+  while (*link != NULL) {
+    if (*link == trampo) {
+      *link = trampo->pending;
+      trampo->pending = TRAMPOLINE_UNTRACKED;
+      return;
+    }
+    link = &(*link)->pending;
+  }
+}
+
+long fbt_has_pending_trampolines(struct thread_local_data *tld, void *target) {
+  struct trampoline *trampo = *pending_bucket(tld, target);
+  for (; trampo != NULL; trampo = trampo->pending) {
+    if (trampo->target == target) {
+      return 1;
+    }
+  }
+  return 0;
+}
+#endif  /* EAGER_BACKPATCHING */
+
+#if defined(TRAMPOLINE_SHARING)
+void fbt_link_shared_origins(struct thread_local_data *tld,
+                             struct trampoline *trampo, void *transl_target) {
+  struct trampoline_origin *other = trampo->origins;
+  while (other != NULL) {
+    struct trampoline_origin *next = other->next;
+    link_origin(other->origin, other->origin_t, trampo, transl_target);
+    other->next = tld->trans.free_origins;
+    tld->trans.free_origins = other;
+    other = next;
+  }
+  trampo->origins = NULL;
+}
+#endif  /* TRAMPOLINE_SHARING */
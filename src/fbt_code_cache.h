@@ -30,36 +30,95 @@
 #ifndef FBT_CODE_CACHE_H
 #define FBT_CODE_CACHE_H
 
+#include "fbt_datatypes.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 /* forward declare structs */
 struct thread_local_data;
+struct ccache_fragment;
 enum origin_type;
 
-  /** mappingtable size: we use 20bit out of the 32bit of an address to perform a
-   lookup in the hashtable. 2^20 * 8 bytes (space for 2 32bit addresses) =
-   8MB. Has to be a power of 2.  */
+  /** initial mappingtable size: we use 20bit out of the 32bit of an address to
+   perform a lookup in the hashtable. 2^20 * 8 bytes (space for 2 32bit
+   addresses) = 8MB. Has to be a power of 2. The table grows at runtime (see
+   struct mapping_table). With LAZY_MAPPINGTABLE we start with 64KB (8192
+   entries). */
+#if defined(LAZY_MAPPINGTABLE)
+#define MAPPINGTABLE_NRBITS 16
+#else
 #define MAPPINGTABLE_NRBITS 23
+#endif  /* LAZY_MAPPINGTABLE */
 #define MAPPINGTABLE_SIZE (0x1<<MAPPINGTABLE_NRBITS)
-#define MAPPINGTABLE_MAXENTRIES (MAPPINGTABLE_SIZE>>3)
-  /**< (i % MAPPINGTABLE_SIZE) should be the same as (i & (HASHTABLE_SIZE - 1)),
-     and the compiler is good at precomputing constant expressions such as
-     (HASHTABLE_SIZE - 1) */
-
-/** We take bits with exponents 2 to 21 (inclusive) of the source address to
-    determine the position in the hash table. Because an entry in the table is 8
-    bytes long, we can only address locations in the table with 8 bytes
-    granularity. To achieve that, the address is shifted one bit to the left and
-    ANDed with this pattern. This gives us the offset into the table.  WARNING:
-    code in fbt_asm_function.S depends on the layout of this definition!
+  /** the table stops growing at 2^26 bytes (8M entries) */
+#define MAPPINGTABLE_MAX_NRBITS 26
+#define MAPPINGTABLE_MAX_SIZE (0x1<<MAPPINGTABLE_MAX_NRBITS)
+#define MAPPINGTABLE_MAXENTRIES(size) ((size)>>3)
+  /**< (i % size) should be the same as (i & (size - 1)) */
+
+  /** The entries (8 bytes each) are grouped into buckets of one cache line.
+      The hash function selects a bucket, an entry is stored in the first free
+      slot of its bucket (or of the following buckets if the bucket is full).
+      A lookup scans the bucket and usually touches a single cache line. */
+#define MAPPINGTABLE_BUCKET_NRBITS 6
+#define MAPPINGTABLE_BUCKET_SIZE (0x1<<MAPPINGTABLE_BUCKET_NRBITS)
+
+/** We take the low bits of the source address (bits 0 to 16 for the initial
+    size) to determine the bucket in the hash table. Because a bucket is 64
+    bytes long, we can only address buckets with 64 bytes granularity. To
+    achieve that, the address is shifted 6 bits to the left and ANDed with this
+    pattern. This gives us the offset of the bucket in the table.  WARNING: the
+    lookup trampolines in ia32/fbt_trampoline.c depend on the layout of this
+    definition!
 */
-#define MAPPING_PATTERN ((MAPPINGTABLE_SIZE-1)^0x7)
+#define MAPPING_PATTERN(size) (((size)-1)^(MAPPINGTABLE_BUCKET_SIZE-1))
 
   /** Implementation of the hash mapping function as C code. The assembly code
       must follow this hash function! */
-#define C_MAPPING_FUNCTION(addr)  ((addr<<3) & MAPPING_PATTERN)
+#define C_MAPPING_FUNCTION(addr, size) \
+  (((addr)<<MAPPINGTABLE_BUCKET_NRBITS) & MAPPING_PATTERN(size))
+
+/**
+ * The mapping table and its bookkeeping. If the table gets too full then we
+ * allocate a table of twice the size and move the entries over incrementally
+ * (on lookups that hit the old table and a couple of entries on every insert).
+ * The lookup trampolines are regenerated for the new table.
+ */
+struct mapping_table {
+  /** current table, the lookup trampolines probe this table */
+  void *table;
+  /** size of the current table in bytes (a power of 2) */
+  ulong_t size;
+  /** table that is being migrated into the current table (or NULL) */
+  void *old_table;
+  /** size of the old table in bytes */
+  ulong_t old_size;
+  /** offset of the next entry in the old table that we migrate */
+  ulong_t migrate_offset;
+
+  /** number of entries in the current table */
+  ulong_t nr_entries;
+  /** sum of the probe lengths of all inserts into the current table */
+  ulong_t nr_probes;
+  /** longest probe chain of an insert into the current table */
+  ulong_t max_probe;
+  /** number of times the table has grown */
+  ulong_t nr_resizes;
+
+  /** index of all entries sorted by their translated address, maps addresses
+      in the code cache back to the original program */
+  struct ccache_fragment *fragments;
+  /** number of entries in fragments */
+  ulong_t nr_fragments;
+  /** capacity of fragments */
+  ulong_t max_fragments;
+
+  /** one bit per page of the original program that holds the start of a
+      fragment (allocated on the first insert) */
+  ulong_t *guest_pages;
+};
 
 /**
  * Checks the mappingtable and checks if there is an entry for orig_address.
@@ -71,6 +130,8 @@ void *fbt_ccache_find(struct thread_local_data *tld, void *orig_address);
 
 /**
  * Adds an entry into the mapping table from orig_address to transl_address.
+ * The entry is also added to the fragment index as an empty fragment, see
+ * fbt_ccache_close_fragment.
  * @param tld pointer to thread local data
  * @param orig_address address in the original program
  * @param transl_address pointer to the translated code fragment
@@ -78,6 +139,84 @@ void *fbt_ccache_find(struct thread_local_data *tld, void *orig_address);
 void fbt_ccache_add_entry(struct thread_local_data *tld, void *orig_address,
                           void *transl_address);
 
+/**
+ * Sets the end of a fragment in the fragment index once the translation of the
+ * fragment is complete.
+ * @param tld pointer to thread local data
+ * @param transl_address start of the fragment in the code cache
+ * @param transl_end first byte after the fragment
+ * @param orig_start lowest guest address that the fragment was translated from
+ * @param orig_end end of the highest guest instruction of the fragment
+ */
+void fbt_ccache_close_fragment(struct thread_local_data *tld,
+                               void *transl_address, void *transl_end,
+                               void *orig_start, void *orig_end);
+
+/**
+ * Marks the guest pages of [start, end) as translated code, so that
+ * fbt_ccache_invalidate looks for fragments if any of them changes. The range
+ * must not span more than two pages (it is one instruction).
+ * @param tld pointer to thread local data
+ * @param start start of the guest code
+ * @param end first byte after the guest code
+ */
+void fbt_ccache_mark_guest(struct thread_local_data *tld, void *start,
+                           void *end);
+
+/**
+ * Checks if code in the given range of the original program was translated
+ * (see fbt_ccache_mark_guest).
+ * @param tld pointer to thread local data
+ * @param start start of the range
+ * @param len length of the range in bytes
+ * @return 1 if any page of the range holds translated code, 0 otherwise
+ */
+long fbt_ccache_has_guest(struct thread_local_data *tld, void *start,
+                          ulong_t len);
+
+/**
+ * Invalidates the translations of all fragments that overlap the given range
+ * of the original program, e.g., because the range is unmapped or may be
+ * modified. The entries are removed from the mapping table and the start of
+ * each fragment is overwritten with a jump to a trampoline, so that jumps into
+ * the stale fragments lead to a new translation. The code cache itself is not
+ * flushed.
+ * @param tld pointer to thread local data
+ * @param start start of the range (rounded down to a page)
+ * @param len length of the range in bytes (rounded up to whole pages)
+ */
+void fbt_ccache_invalidate(struct thread_local_data *tld, void *start,
+                           ulong_t len);
+
+/**
+ * Moves all remaining entries of the old into the current mapping table, so
+ * that the current table holds all entries and the old table is released.
+ * @param tld pointer to thread local data
+ */
+void fbt_ccache_finish_migration(struct thread_local_data *tld);
+
+#if defined(CCACHE_EVICTION)
+/**
+ * Records a direct jump from one fragment into another fragment. The jump is
+ * redirected to a trampoline if the target fragment is evicted.
+ * @param tld pointer to thread local data
+ * @param origin location of the jump target in the code cache
+ * @param origin_t addressing type of the origin
+ */
+void fbt_ccache_add_link(struct thread_local_data *tld, void *origin,
+                         enum origin_type origin_t);
+
+/**
+ * Evicts the oldest chunks of the code cache until at most CCACHE_MAX_CHUNKS
+ * chunks are left. The first chunk (with the trampolines) is never evicted.
+ * This must only be called from a safe point, i.e., when no code cache address
+ * of an evicted chunk is held anywhere except in recorded links, trampolines,
+ * and predictions.
+ * @param tld pointer to thread local data
+ */
+void fbt_ccache_evict(struct thread_local_data *tld);
+#endif  /* CCACHE_EVICTION */
+
 /**
  * Flushes the code cache
  * @param tld pointer to thread local data
@@ -85,14 +224,24 @@ void fbt_ccache_add_entry(struct thread_local_data *tld, void *orig_address,
 void fbt_ccache_flush(struct thread_local_data *tld);
 
 /**
- * Scans the mappingtable and checks if there is an entry with transl_address.
+ * Searches the fragment index (binary search) for the fragment that starts at
+ * or contains transl_address. With a shared code cache the caller must hold
+ * the lock of the code cache.
  * @param tld pointer to thread local data
  * @param transl_address address in the translated program
- * @return pointer to the original code (or NULL)
+ * @return pointer to the original code of the fragment (or NULL)
  */
 void *fbt_ccache_find_reverse(struct thread_local_data *tld,
                               void *transl_address);
 
+/**
+ * Prints the load factor and the probe lengths of the mapping table and the
+ * state of the predictions for indirect control flow transfers (the state of
+ * each prediction goes to the debug output).
+ * @param tld pointer to thread local data
+ */
+void fbt_ccache_print_statistics(struct thread_local_data *tld);
+
 /**
  * Creates and returns a new trampoline.
  * If there are no more trampolines available in the TLD then we allocate a
@@ -108,6 +257,51 @@ struct trampoline *fbt_create_trampoline(struct thread_local_data *tld,
                                          void *call_target, void *origin,
                                          enum origin_type origin_type);
 
+#if defined(EAGER_BACKPATCHING)
+/** number of buckets in the hash table of pending trampolines (one page) */
+#define PENDING_TRAMPOLINES_SIZE (PAGESIZE / sizeof(struct trampoline*))
+
+/**
+ * Links all jumps that wait in a trampoline for the translation of target to
+ * the translated code and frees their trampolines. Called whenever a new
+ * fragment is translated.
+ * @param tld thread local data
+ * @param target IP in the untranslated code
+ * @param transl_target translation of target in the code cache
+ */
+void fbt_link_pending_trampolines(struct thread_local_data *tld, void *target,
+                                  void *transl_target);
+
+/**
+ * Removes a trampoline from the table of pending trampolines (if it is in the
+ * table), e.g., because it is freed or taken.
+ * @param tld thread local data
+ * @param trampo the trampoline
+ */
+void fbt_untrack_trampoline(struct thread_local_data *tld,
+                            struct trampoline *trampo);
+
+/**
+ * Checks if any jump waits in a trampoline for the translation of target.
+ * @param tld thread local data
+ * @param target IP in the untranslated code
+ * @return 1 if there is a pending trampoline for target, 0 otherwise
+ */
+long fbt_has_pending_trampolines(struct thread_local_data *tld, void *target);
+#endif  /* EAGER_BACKPATCHING */
+
+#if defined(TRAMPOLINE_SHARING)
+/**
+ * Links the further jumps that share a trampoline (all but the origin of the
+ * trampoline) to the translated target.
+ * @param tld thread local data
+ * @param trampo the trampoline
+ * @param transl_target translation of the target of the trampoline
+ */
+void fbt_link_shared_origins(struct thread_local_data *tld,
+                             struct trampoline *trampo, void *transl_target);
+#endif  /* TRAMPOLINE_SHARING */
+
 #ifdef __cplusplus
 }
 #endif
@@ -32,6 +32,148 @@
 # include "generic/fbt_mutex.h"  // for fbt_mutex_t
 #endif
 
+#if defined(SHARED_CODE_CACHE)
+# if !defined(SHARED_DATA) || !defined(AUTHORIZE_SYSCALLS) || \
+     !defined(HANDLE_THREADS)
+#  error "SHARED_CODE_CACHE requires SHARED_DATA and HANDLE_THREADS"
+# endif
+# if defined(__arm__)
+#  error "SHARED_CODE_CACHE is not implemented for ARM"
+# endif
+#endif  /* SHARED_CODE_CACHE */
+
+#if defined(CCACHE_EVICTION)
+# if defined(SHARED_CODE_CACHE) || defined(__arm__)
+#  error "CCACHE_EVICTION is not implemented for SHARED_CODE_CACHE and ARM"
+# endif
+# if !defined(CCACHE_MAX_CHUNKS)
+/** the code cache of a thread uses at most this many chunks of
+    CODE_CACHE_ALLOC_PAGES pages, older chunks are evicted */
+#  define CCACHE_MAX_CHUNKS 16
+# endif
+# if CCACHE_MAX_CHUNKS < 2
+#  error "CCACHE_MAX_CHUNKS must be at least 2"
+# endif
+/** chunks that may be allocated on top of CCACHE_MAX_CHUNKS until the next
+    eviction */
+# define CCACHE_CHUNKS_SLACK 4
+#endif  /* CCACHE_EVICTION */
+
+#if defined(PERSISTENT_CCACHE)
+# if defined(SHARED_CODE_CACHE) || defined(CCACHE_EVICTION) || \
+     defined(__arm__)
+#  error "PERSISTENT_CCACHE is not implemented for SHARED_CODE_CACHE, \
+CCACHE_EVICTION and ARM"
+# endif
+#endif  /* PERSISTENT_CCACHE */
+
+#if defined(HOT_TRACES)
+# if defined(SHARED_CODE_CACHE) || defined(CCACHE_EVICTION) || \
+     defined(PERSISTENT_CCACHE) || defined(__arm__)
+#  error "HOT_TRACES is not implemented for SHARED_CODE_CACHE, \
+CCACHE_EVICTION, PERSISTENT_CCACHE and ARM"
+# endif
+#endif  /* HOT_TRACES */
+
+#if defined(TIERED_TRANSLATION)
+# if defined(SHARED_CODE_CACHE) || defined(CCACHE_EVICTION) || \
+     defined(PERSISTENT_CCACHE) || defined(__arm__)
+#  error "TIERED_TRANSLATION is not implemented for SHARED_CODE_CACHE, \
+CCACHE_EVICTION, PERSISTENT_CCACHE and ARM"
+# endif
+#endif  /* TIERED_TRANSLATION */
+
+#if defined(SHADOW_STACK)
+# if defined(__arm__)
+#  error "SHADOW_STACK is not implemented for ARM"
+# endif
+/** number of entries of the shadow stack. The translated code indexes the
+    shadow stack with a byte, so that the index wraps around without changing
+    the flags. */
+# define SHADOW_STACK_SIZE 256
+/** number of entries below the top that a translated return searches for its
+    return address if the top entry does not match */
+# if !defined(SHADOW_STACK_SEARCH)
+#  define SHADOW_STACK_SEARCH 8
+# endif
+#endif  /* SHADOW_STACK */
+
+#if defined(RET_CACHE)
+# if defined(SHARED_CODE_CACHE) || defined(SHADOW_STACK) || defined(__arm__)
+#  error "RET_CACHE is not implemented for SHARED_CODE_CACHE, SHADOW_STACK \
+and ARM"
+# endif
+# if !defined(RET_CACHE_ENTRIES)
+/** number of entries of the return cache of a ret instruction */
+#  define RET_CACHE_ENTRIES 8
+# endif
+# if RET_CACHE_ENTRIES & (RET_CACHE_ENTRIES - 1)
+#  error "RET_CACHE_ENTRIES must be a power of 2"
+# endif
+#endif  /* RET_CACHE */
+
+#if defined(JUMP_TABLES)
+# if defined(SHARED_CODE_CACHE) || defined(CCACHE_EVICTION) || \
+     defined(PERSISTENT_CCACHE) || defined(__arm__)
+#  error "JUMP_TABLES is not implemented for SHARED_CODE_CACHE, \
+CCACHE_EVICTION, PERSISTENT_CCACHE and ARM"
+# endif
+/** larger jump tables are dispatched like any other indirect jump */
+# define JUMP_TABLE_MAX_ENTRIES 1024
+#endif  /* JUMP_TABLES */
+
+#if defined(PLT_CHAINING)
+# if defined(SHARED_CODE_CACHE) || defined(CCACHE_EVICTION) || \
+     defined(PERSISTENT_CCACHE) || defined(__arm__)
+#  error "PLT_CHAINING is not implemented for SHARED_CODE_CACHE, \
+CCACHE_EVICTION, PERSISTENT_CCACHE and ARM"
+# endif
+#endif  /* PLT_CHAINING */
+
+#if defined(TRAMPOLINE_FAST_PATH)
+# if defined(SHARED_CODE_CACHE) || defined(CCACHE_EVICTION) || defined(__arm__)
+#  error "TRAMPOLINE_FAST_PATH is not implemented for SHARED_CODE_CACHE, \
+CCACHE_EVICTION and ARM"
+# endif
+#endif  /* TRAMPOLINE_FAST_PATH */
+
+#if defined(EAGER_BACKPATCHING)
+# if defined(SHARED_CODE_CACHE) || defined(CCACHE_EVICTION) || \
+     defined(PERSISTENT_CCACHE) || defined(__arm__)
+#  error "EAGER_BACKPATCHING is not implemented for SHARED_CODE_CACHE, \
+CCACHE_EVICTION, PERSISTENT_CCACHE and ARM"
+# endif
+#endif  /* EAGER_BACKPATCHING */
+
+#if defined(TRAMPOLINE_SHARING) && !defined(EAGER_BACKPATCHING)
+# error "TRAMPOLINE_SHARING depends on EAGER_BACKPATCHING"
+#endif  /* TRAMPOLINE_SHARING */
+
+#if defined(BATCH_TRANSLATION) && !defined(EAGER_BACKPATCHING)
+# error "BATCH_TRANSLATION depends on EAGER_BACKPATCHING"
+#endif  /* BATCH_TRANSLATION */
+
+#if defined(TARGET_REG_LOOKUP) && defined(__arm__)
+# error "TARGET_REG_LOOKUP is not implemented for ARM"
+#endif  /* TARGET_REG_LOOKUP */
+
+#if defined(FLAG_LIVENESS)
+# if !defined(ICF_PREDICT)
+#  error "FLAG_LIVENESS depends on ICF_PREDICT"
+# endif
+# if defined(SHARED_CODE_CACHE) || defined(__arm__)
+#  error "FLAG_LIVENESS is not implemented for SHARED_CODE_CACHE and ARM"
+# endif
+#endif  /* FLAG_LIVENESS */
+
+#if defined(TRANSLATION_IR) && defined(__arm__)
+# error "TRANSLATION_IR is not implemented for ARM"
+#endif  /* TRANSLATION_IR */
+
+#if defined(JCC_FALLTHROUGH) && defined(__arm__)
+# error "JCC_FALLTHROUGH is not implemented for ARM"
+#endif  /* JCC_FALLTHROUGH */
+
 typedef unsigned long ulong_t;
 
 /* forward declare these structs */
@@ -44,6 +186,13 @@ struct arm_opcode;
 typedef struct arm_opcode ArchOpcode;
 #endif
 struct mem_info;
+struct mapping_table;
+#if defined(CCACHE_EVICTION)
+struct ccache_link;
+#endif  /* CCACHE_EVICTION */
+#if defined(HOT_TRACES)
+struct trace_cache;
+#endif  /* HOT_TRACES */
 struct trampoline;
 struct dso_chain;
 #if defined(SHARED_DATA)
@@ -61,6 +210,30 @@ typedef unsigned char Code;
 typedef unsigned long Code;
 #endif
 
+#if defined(TRANSLATION_IR)
+/** the instruction is not emitted (removed by an optimization pass) */
+#define IR_DELETED 0x1
+
+/**
+ * A decoded instruction of the translation unit. fbt_translate_unit decodes a
+ * run of instructions into an array of these, runs the optimization passes
+ * over the array and then hands the remaining instructions to their actions.
+ * The fields are copies of the corresponding fields of struct translate.
+ */
+struct ir_instr {
+  Code *cur_instr;
+  Code *next_instr;
+  const ArchOpcode *cur_instr_info;
+  unsigned char *first_byte_after_opcode;
+  unsigned char num_prefixes;
+  unsigned char dest_operand_size;
+  unsigned char src_operand_size;
+  unsigned char aux_operand_size;
+  /** IR_* flags set by the passes */
+  unsigned char flags;
+};
+#endif  /* TRANSLATION_IR */
+
 /**
  * This struct is used when a new instruction is parsed and translated.
  * The struct gets updated through the disassembling function and the
@@ -74,6 +247,32 @@ struct translate {
   Code *code_cache_end;
   /** list of unused trampolines */
   struct trampoline *trampos;
+#if defined(EAGER_BACKPATCHING)
+  /** hash table of the trampolines whose target is not translated yet (see
+      fbt_link_pending_trampolines) */
+  struct trampoline **pending_trampos;
+#endif  /* EAGER_BACKPATCHING */
+#if defined(TRAMPOLINE_SHARING)
+  /** list of unused origins of shared trampolines */
+  struct trampoline_origin *free_origins;
+#endif  /* TRAMPOLINE_SHARING */
+#if defined(BATCH_TRANSLATION)
+  /** ring buffer of targets of pending trampolines that are translated ahead
+      of time (see fbt_translate_speculative) */
+  void **spec_queue;
+  /** number of targets pushed to spec_queue so far (the newest target is at
+      spec_top - 1) */
+  ulong_t spec_top;
+  /** number of targets in spec_queue */
+  ulong_t spec_count;
+  /** set while a queued target is translated ahead of time. The translation
+      then stops in front of code that it cannot read or translate and leaves
+      it to the regular translation (instead of ending the program). */
+  unsigned char speculative;
+  /** pages that are known to be readable during a speculative translation */
+  Code *spec_readable_start;
+  Code *spec_readable_end;
+#endif  /* BATCH_TRANSLATION */
   /** pointer to the instruction that is currently being translated */
   Code *cur_instr;
   /** information about the current instruction (or NULL) */
@@ -88,11 +287,44 @@ struct translate {
   unsigned char aux_operand_size;
   /** pointer to the next instruction (only valid after decoding) */
   Code *next_instr;
+  /** guest code of the fragment that is currently being translated, from its
+      lowest instruction to the end of its highest instruction (see
+      fbt_ccache_close_fragment) */
+  Code *orig_start;
+  Code *orig_end;
 #if defined(INLINE_CALLS)
   /** Pointer to the return address of the upper call if we are currently
       inlining, NULL otherwise. */
   void *inline_call_RIP;
 #endif
+#if defined(HOT_TRACES)
+  /** set while a block is translated into a trace. All direct jumps of the
+      block then go through trampolines, see fbt_trace.c */
+  unsigned char in_trace;
+#endif  /* HOT_TRACES */
+#if defined(TIERED_TRANSLATION)
+  /** 0 for the quick translation of new code, 1 while a hot fragment is
+      translated again with all optimizations (see fbt_translate_tier1) */
+  unsigned char tier;
+#endif  /* TIERED_TRANSLATION */
+#if defined(JUMP_TABLES)
+  /** the instruction that was translated before the current one in this TU
+      (or NULL at the start of the TU) */
+  Code *prev_instr;
+#endif  /* JUMP_TABLES */
+#if defined(TRANSLATION_IR)
+  /** buffer for the decoded instructions of the TU (TRANSLATION_IR_SIZE
+      entries), allocated once per thread and reused for every translation */
+  struct ir_instr *ir;
+#endif  /* TRANSLATION_IR */
+#if defined(SHARED_CODE_CACHE)
+  /** Entry of the TU that is currently being translated. Other threads read the
+      shared mapping table without locking, therefore the entry is only
+      published after the whole TU is written. Until then fbt_ccache_find
+      returns it to the translating thread only. */
+  void *tu_orig_address;
+  Code *tu_transl_address;
+#endif  /* SHARED_CODE_CACHE */
 
   /** pointer back to tld (for action functions) */
   struct thread_local_data *tld;
@@ -143,6 +375,81 @@ enum syscall_auth_response {
 } __attribute__((packed));
 #endif  /* AUTHORIZE_SYSCALLS */
 
+#if defined(SHADOW_STACK)
+/**
+ * An entry of the shadow stack: the return address that a call pushed onto the
+ * stack and the code that the translated return jumps to.
+ */
+struct shadow_entry {
+  /** return address in the original program */
+  ulong_t ret;
+  /** translation of the return address (or a trampoline) */
+  void *transl;
+};
+#endif  /* SHADOW_STACK */
+
+#if defined(JUMP_TABLES)
+/**
+ * The translation of the jump table of a switch statement: the translated code
+ * dispatches through transl instead of the table of the program. Entries whose
+ * target is not translated yet point to the fill stub, which fills in the
+ * translated target when the entry is used for the first time.
+ */
+struct jump_table {
+  /** table of the program (in read-only memory) */
+  ulong_t *table;
+  /** number of entries of both tables */
+  ulong_t nr_entries;
+  /** stub that dispatches through the table of the program, used for all
+      entries once the table may have changed (see fbt_ccache_invalidate) */
+  Code *fallback;
+  /** stub that stores the index in tld->jump_table_index and enters the BT
+      through a trampoline with origin ORIGIN_JUMP_TABLE */
+  Code *fill;
+  /** translated targets */
+  void **transl;
+  /** next jump table of this thread */
+  struct jump_table *next;
+};
+#endif  /* JUMP_TABLES */
+
+#if defined(PLT_CHAINING)
+/**
+ * Guard of the translated jump of a PLT stub: the jump goes straight to the
+ * translation of the target as long as the GOT entry holds the target that was
+ * seen last.
+ */
+struct plt_guard {
+  /** immediate in the code cache that holds the negated target */
+  ulong_t *expected;
+  /** target of the jump to the translated target in the code cache */
+  Code *hit;
+  /** target of the jump to the fixup trampoline in the code cache */
+  Code *miss;
+  /** number of targets that were filled in */
+  ulong_t nrfixes;
+};
+#endif  /* PLT_CHAINING */
+
+#if defined(RET_CACHE)
+/**
+ * Direct mapped cache of the translated return addresses of a ret instruction.
+ * The entry is selected by the low bits of the return address.
+ */
+struct ret_cache {
+  struct {
+    /** return address in the original program (0 if the entry is unused) */
+    ulong_t ret;
+    /** translation of the return address */
+    void *transl;
+  } entries[RET_CACHE_ENTRIES];
+  /** target of the jump to the fixup trampoline in the code cache */
+  Code *miss;
+  /** number of entries that were filled in */
+  ulong_t nrfills;
+};
+#endif  /* RET_CACHE */
+
 /**
  * This struct defines thread local data that is needed inside the BT.
  * These fields are set during the startup of the BT and then used whenever
@@ -150,7 +457,20 @@ enum syscall_auth_response {
  */
 struct thread_local_data {
   /** mapping table between code cache and program */
-  void *mappingtable;
+  struct mapping_table *mappingtable;
+#if defined(HOT_TRACES)
+  /** traces of hot code and the execution counters (allocated on the first
+      loop head, see fbt_trace.c) */
+  struct trace_cache *traces;
+#endif  /* HOT_TRACES */
+#if defined(TIERED_TRANSLATION)
+  /** next free execution counter for a fragment of the first tier */
+  ulong_t *tier_counters;
+  /** end of the page of execution counters */
+  ulong_t *tier_counters_end;
+  /** %ecx is saved here while the counter of a fragment is updated */
+  ulong_t tier_scratch;
+#endif  /* TIERED_TRANSLATION */
 #ifdef __arm__
   /** mapping table between translated code's PC and program's PC */
   void *pc_mappingtable;
@@ -172,11 +492,61 @@ struct thread_local_data {
   void *opt_ijump_trampoline;
   /** same as opt_ijump_trampoline but for indirect calls */
   void *opt_icall_trampoline;
+#if defined(TARGET_REG_LOOKUP)
+  /** variants of opt_ijump_trampoline for targets in a register, indexed by
+      the number of the register (NULL for %ebx and %esp) */
+  void *opt_ijump_reg_trampoline[8];
+  /** same as opt_ijump_reg_trampoline but for indirect calls */
+  void *opt_icall_reg_trampoline[8];
+#endif  /* TARGET_REG_LOOKUP */
   /** this trampoline is used for plain return instructions */
   void *opt_ret_trampoline;
   /** this trampoline is used for return instructions that additionally pop a
       couple of bytes from the stack */
   void *opt_ret_remove_trampoline;
+#if defined(SHADOW_STACK)
+  /** index of the top entry of the shadow stack */
+  unsigned char shadow_top;
+  /** %ecx, %edx and %eax are saved here while the shadow stack is updated */
+  ulong_t shadow_scratch[3];
+  /** return addresses of the calls in the code cache and their translations.
+      Translated returns jump straight to the translation if the return
+      address on the stack matches the top entry or one of the
+      SHADOW_STACK_SEARCH entries below it (see action_ret). The oldest
+      entries are overwritten if the calls nest too deep. */
+  struct shadow_entry shadow_stack[SHADOW_STACK_SIZE];
+#endif  /* SHADOW_STACK */
+#if defined(RET_CACHE)
+  /** trampoline that fills in an entry of the return cache of a ret
+      instruction */
+  void *opt_ret_cache_fixup;
+  /** next free return cache (see action_ret) */
+  struct ret_cache *ret_caches;
+  /** end of the page of return caches */
+  struct ret_cache *ret_caches_end;
+#endif  /* RET_CACHE */
+#if defined(PLT_CHAINING)
+  /** trampoline that fills in the target of a PLT guard */
+  void *opt_plt_fixup;
+  /** %ecx is saved here while a PLT guard runs */
+  ulong_t plt_scratch;
+#endif  /* PLT_CHAINING */
+#if defined(JUMP_TABLES)
+  /** all translated jump tables of this thread */
+  struct jump_table *jump_tables;
+  /** next free entry for translated jump tables */
+  void **jump_table_entries;
+  /** end of the chunk of entries */
+  void **jump_table_entries_end;
+  /** index of the entry that the fill stub of a jump table was entered for */
+  ulong_t jump_table_index;
+  /** the mapping of the last query of fbt_mem_is_readonly (start, end, and
+      whether it is read-only), so that the maps are not parsed for every
+      switch statement */
+  ulong_t readonly_map_start;
+  ulong_t readonly_map_end;
+  long readonly_map;
+#endif  /* JUMP_TABLES */
 
 #if defined(ICF_PREDICT)
   /** trampoline that handles a misprediction of an indirect control flow
@@ -235,6 +605,20 @@ struct thread_local_data {
       translated. */
   struct translate trans;
 
+#if defined(CCACHE_EVICTION)
+  /** code cache chunks from the oldest to the newest. The first chunk also
+      holds the trampolines and is never evicted. */
+  void *ccache_chunks[CCACHE_MAX_CHUNKS + CCACHE_CHUNKS_SLACK];
+  /** number of chunks in ccache_chunks */
+  long ccache_nr_chunks;
+  /** direct jumps between fragments (see fbt_ccache_add_link) */
+  struct ccache_link *links;
+  /** number of entries in links */
+  ulong_t nr_links;
+  /** capacity of links */
+  ulong_t max_links;
+#endif  /* CCACHE_EVICTION */
+
 #ifdef SHARED_DATA
   /** Data that is shared between all threads */
   struct shared_data *shared_data;
@@ -258,6 +642,29 @@ enum origin_type {
   ORIGIN_RELATIVE,
   /** use an absolute address */
   ORIGIN_ABSOLUTE,
+#if defined(HOT_TRACES)
+  /** relative address in a counter stub that has reached its threshold, the
+      target is the head of a new trace (see fbt_trace.c) */
+  ORIGIN_TRACE,
+#endif  /* HOT_TRACES */
+#if defined(TIERED_TRANSLATION)
+  /** relative address at the start of a fragment of the first tier whose
+      counter has expired, the target is translated again by the optimizing
+      tier (see fbt_translate_tier1) */
+  ORIGIN_TIER,
+#endif  /* TIERED_TRANSLATION */
+#if defined(JUMP_TABLES)
+  /** origin is a struct jump_table whose entry tld->jump_table_index is
+      reached for the first time, the entry is filled in with the translated
+      target (the trampoline is shared by all entries and never freed) */
+  ORIGIN_JUMP_TABLE,
+#endif  /* JUMP_TABLES */
+#if defined(SHADOW_STACK)
+  /** absolute address of the translated return address of a call. Entries of
+      the shadow stack might still point to the trampoline after the
+      backpatching, so the trampoline is never freed */
+  ORIGIN_SHADOW,
+#endif  /* SHADOW_STACK */
 };
 
 /**
@@ -275,10 +682,19 @@ enum origin_type {
  * [ target                 ]
  * The call to trampo then leaves the RIP on the stack with whom we can
  * construct a pointer to origin and target.
+ * With a shared code cache the secure stack is reached through %fs and the code
+ * takes TRAMPOLINE_CODE_LEN = 23 bytes instead of 16.
  */
+#if defined(SHARED_CODE_CACHE)
+# define TRAMPOLINE_CODE_WORDS 5
+# define TRAMPOLINE_CODE_LEN 23
+#else
+# define TRAMPOLINE_CODE_WORDS 3
+# define TRAMPOLINE_CODE_LEN 16
+#endif  /* SHARED_CODE_CACHE */
 struct trampoline {
   /** placeholder for code */
-  ulong_t code[3];
+  ulong_t code[TRAMPOLINE_CODE_WORDS];
   /** either a pointer to the next free trampoline (if used in the free list) or
       the tail of the code to jump into the BT */
   struct trampoline *next;
@@ -288,30 +704,97 @@ struct trampoline {
   Code *target;
   /** type of origin */
   enum origin_type origin_t;
+#if defined(EAGER_BACKPATCHING)
+  /** next trampoline in the same bucket of the pending trampolines, or
+      TRAMPOLINE_UNTRACKED if the trampoline is not pending */
+  struct trampoline *pending;
+#endif  /* EAGER_BACKPATCHING */
+#if defined(TRAMPOLINE_SHARING)
+  /** further jumps to the same target that share this trampoline (origin
+      holds the jump that was added last) */
+  struct trampoline_origin *origins;
+#endif  /* TRAMPOLINE_SHARING */
+};
+
+#if defined(EAGER_BACKPATCHING)
+/** value of trampoline.pending for trampolines that are not pending */
+#define TRAMPOLINE_UNTRACKED ((struct trampoline*)-1)
+#endif  /* EAGER_BACKPATCHING */
+
+#if defined(TRAMPOLINE_SHARING)
+/**
+ * Further origin of a trampoline that is shared by several jumps to the same
+ * untranslated target.
+ */
+struct trampoline_origin {
+  /** origin in the code cache (to fix/backpatch the jump location) */
+  Code *origin;
+  /** type of origin */
+  enum origin_type origin_t;
+  /** next origin of the trampoline (or next free origin) */
+  struct trampoline_origin *next;
 };
+#endif  /* TRAMPOLINE_SHARING */
 
 #if defined(ICF_PREDICT)
+/** number of targets that are cached per indirect control flow transfer */
+#if !defined(ICF_PREDICT_WAYS)
+# define ICF_PREDICT_WAYS 4
+#endif
+
 /**
  * Structure for indirect control flow transfer predictions.
  * This structure is used in the optimized indirect control flow
- * prediction. This optimization caches the last two lookup locations in a local
- * cache. If there is a cache hit then we have a fast control flow transfer to
- * the cached lookup location. If there is a cache miss then we calculate a
- * lookup and update the cache. If the amount mispredictions is higher than
- * ICF_PREDICT_MAX_MISPREDICTIONS, then we rewrite the optimization into a fast
- * lookup.
+ * prediction. This optimization caches up to ICF_PREDICT_WAYS targets in a
+ * chain of compares (a polymorphic inline cache). If there is a cache hit then
+ * we have a fast control flow transfer to the cached lookup location. If there
+ * is a cache miss then we calculate a lookup and add the target to the chain;
+ * the chain is kept ordered by the number of hits of each target. If the chain
+ * is full and the amount of mispredictions is higher than
+ * ICF_PREDICT_MAX_MISPREDICTIONS, then the transfer is megamorphic and we
+ * redirect it to a stub that uses the fast lookup. The stub samples the
+ * targets of the transfer from time to time and re-arms the chain once the
+ * transfer is stable again.
  */
+enum icf_predict_state {
+  ICF_PREDICTING,  /**< the chain of cached targets is used */
+  ICF_MEGAMORPHIC,  /**< the fast lookup is used, targets are sampled */
+  ICF_PROFILING  /**< the fast lookup is used, all targets are recorded */
+};
+
 struct icf_prediction {
   union {
     void *src;  /**< Source of the prediction in the code cache */
     struct icf_prediction *next; /**< Pointer to the next free prediction in a
                                     the free list. */
   } pred;
-  ulong_t *origin1;  /**< Ptr into the code cache (to 1st location). */
-  ulong_t *dst1;  /**< Ptr into code cache (to 1st destination). */
-  //void *origin2;  /**< Origin in the original code of the 2nd cache location. */
-  //void *dst2;  /**< Destination in the code cache of the 2nd cache location. */
-  ulong_t nrmispredict;  /**< Number of mispredictions */
+  /** Ptrs into the code cache (to the cached targets in the original code,
+      0 if the entry is unused). */
+  ulong_t *origin[ICF_PREDICT_WAYS];
+  /** Ptrs into the code cache (to the destinations of the cached targets). */
+  ulong_t *dst[ICF_PREDICT_WAYS];
+#if defined(FLAG_LIVENESS)
+  /** Ptrs into the code cache (to the flag restores of the entries). The first
+      two bytes are replaced by a short jump over the restore if the flags are
+      dead at the cached target. */
+  unsigned char *restore[ICF_PREDICT_WAYS];
+  /** First two bytes of a flag restore (if the flags are live) */
+  unsigned char restore_code[2];
+  /** Length of a flag restore in bytes */
+  unsigned char restore_len;
+#endif  /* FLAG_LIVENESS */
+  /** Number of hits of the entries (updated by the code in the code cache) */
+  ulong_t hits[ICF_PREDICT_WAYS];
+  ulong_t nrhits;  /**< Sum of the hits after the last rewrite of the chain */
+  ulong_t nrmispredict;  /**< Number of mispredictions with a full chain */
+  enum icf_predict_state state;  /**< Current state of the prediction */
+  void *megamorphic;  /**< Stub in the code cache that is used instead of the
+                         chain if the transfer is megamorphic */
+  ulong_t countdown;  /**< Executions of the stub until the next sample (updated
+                         by the code in the code cache) */
+  ulong_t period;  /**< Executions of the stub between two samples */
+  ulong_t nrsamples;  /**< Number of samples in the current profiling window */
+  ulong_t nrrearms;  /**< Number of times the chain was re-armed */
 };
 #endif  /* ICF_PREDICT */
 
@@ -332,6 +815,40 @@ struct shared_data {
 
   /** The commit function when start_transaction was called */
   void (*commit_function)();
+
+#if defined(SHARED_CODE_CACHE)
+  /** Lock that serializes all translations into the shared code cache. Lookups
+      in the mapping table do not take this lock. */
+  fbt_mutex_t ccache_mutex;
+  /** mapping table that is used by all threads */
+  struct mapping_table *mappingtable;
+  /** syscall table that is used by all threads (the shared trampolines call
+      through a fixed address) */
+  void *syscall_table;
+  /** current position in the shared code cache (only valid while nobody holds
+      ccache_mutex, the owner works on its tld->trans copy) */
+  Code *transl_instr;
+  /** end of the shared code cache */
+  Code *code_cache_end;
+  /** list of unused trampolines */
+  struct trampoline *trampos;
+#if defined(ICF_PREDICT)
+  /** list of unused icf predictions */
+  struct icf_prediction *icf_predict;
+#endif  /* ICF_PREDICT */
+  /** memory chunks that are shared among all threads (code cache, mapping
+      table, trampolines, ...), these are never freed */
+  struct mem_info *chunk;
+  /** small memory for the mem_info structs of the shared chunks */
+  void *smalloc;
+  /** amount of memory left at smalloc */
+  long smalloc_size;
+  /** GDT entry of the segment (%fs) that points to the tld of the current
+      thread, -1 if not yet allocated */
+  int tld_segment;
+  /** number of translated TUs (all threads) */
+  ulong_t nr_translations;
+#endif  /* SHARED_CODE_CACHE */
 };
 
 /** Stores information about a list of threads. Each node should be allocated
@@ -32,6 +32,12 @@
 #include <assert.h>
 #include <errno.h>
 #include <asm-generic/mman.h>
+#if defined(SHARED_CODE_CACHE)
+# include <asm/ldt.h>  // for struct user_desc
+#endif
+#if defined(JUMP_TABLES)
+# include <asm-generic/fcntl.h>
+#endif
 
 #include "fbt_code_cache.h"
 #ifdef __arm__
@@ -40,10 +46,36 @@
 #include "fbt_datatypes.h"
 #include "fbt_debug.h"
 #include "fbt_mem_pool.h"
+#if defined(PERSISTENT_CCACHE)
+# include "fbt_persistent_cache.h"
+#endif
 #include "fbt_syscall.h"
+#if defined(TRANSLATION_IR) || defined(BATCH_TRANSLATION)
+# include "fbt_translate.h"
+#endif  /* TRANSLATION_IR || BATCH_TRANSLATION */
 #include "generic/fbt_libc.h"
 #include "generic/fbt_llio.h"
 
+/**
+ * Allocates the mapping table, the syscall table and the first chunk of the
+ * code cache. With SHARED_CODE_CACHE these structures are allocated once
+ * (fbt_init_shared_data) and then used by all threads.
+ * @param tld thread local data
+ */
+static void allocate_translation_data(struct thread_local_data *tld);
+
+/**
+ * Maps memory for a new chunk of the given thread.
+ * @param tld thread local data that owns the chunk (or NULL for the initial
+ * chunk of a new thread)
+ * @param size size of the chunk in bytes
+ * @param prot protection flags
+ * @param map_flags flags for mmap
+ * @return the address of the chunk (or an error code)
+ */
+static void *map_chunk(struct thread_local_data *tld, ulong_t size, long prot,
+                       long map_flags);
+
 struct thread_local_data *fbt_init_tls() {
   return fbt_reinit_tls(NULL);
 }
@@ -52,8 +84,8 @@ struct thread_local_data *fbt_reinit_tls(struct thread_local_data *tld) {
   /* allocate (bootstrapping) memory */
   void *mem;
   if (tld == NULL) {
-    fbt_mmap(NULL, SMALLOC_PAGES * PAGESIZE, PROT_READ|PROT_WRITE,
-             MAP_PRIVATE|MAP_ANONYMOUS, -1, 0, mem);
+    mem = map_chunk(NULL, SMALLOC_PAGES * PAGESIZE, PROT_READ|PROT_WRITE,
+                    MAP_PRIVATE|MAP_ANONYMOUS);
     SYSCALL_SUCCESS_OR_SUICIDE_STR(
         mem, "BT failed to allocate memory (fbt_reinit_tls: fbt_mem_mgmt.c)\n");
   } else {
@@ -86,11 +118,18 @@ struct thread_local_data *fbt_reinit_tls(struct thread_local_data *tld) {
   tld->trans.transl_instr = NULL;
   tld->trans.code_cache_end = NULL;
   tld->trans.trampos = NULL;
+#if defined(TRAMPOLINE_SHARING)
+  tld->trans.free_origins = NULL;
+#endif  /* TRAMPOLINE_SHARING */
   tld->trans.cur_instr = NULL;
   tld->trans.cur_instr_info = NULL;
   tld->trans.first_byte_after_opcode = NULL;
   tld->trans.num_prefixes = 0;
   tld->trans.next_instr = NULL;
+#if defined(SHARED_CODE_CACHE)
+  tld->trans.tu_orig_address = NULL;
+  tld->trans.tu_transl_address = NULL;
+#endif  /* SHARED_CODE_CACHE */
 
   tld->smalloc = (void*)(tld->chunk + 1);
   tld->smalloc_size = (SMALLOC_PAGES * PAGESIZE) - ((ulong_t)(tld->smalloc) -
@@ -100,30 +139,16 @@ struct thread_local_data *fbt_reinit_tls(struct thread_local_data *tld) {
 
   /* starting from this point we can use our internal memory allocation */
 
-  /* allocate memory for hashtable(s).
-     lalloc uses mmap and map_anonymous, so the table is initialized with 0x0
-     therefore we don't need to memset the whole table+4 for 0x1 guard for
-     tcache_find_fast asm function */
-  tld->mappingtable = fbt_lalloc(tld, (MAPPINGTABLE_SIZE / PAGESIZE) + 1,
-                                 MT_MAPPING_TABLE);
-#ifdef __arm__
-  tld->pc_mappingtable = fbt_lalloc(tld, (PC_MAPPINGTABLE_SIZE / PAGESIZE) + 1,
-                                    MT_PC_MAPPING_TABLE);
-#endif
-  /* guard for find_fast-wraparound used in optimizations */
-  *(long*)((long)(tld->mappingtable) + MAPPINGTABLE_SIZE) = 0x1;
-
-  PRINT_DEBUG("allocated mappingtable: %p -> %p",
-              tld->mappingtable, tld->mappingtable + MAPPINGTABLE_SIZE);
-#ifdef __arm__
-  PRINT_DEBUG("allocated pc_mappingtable: %p -> %p",
-              tld->pc_mappingtable, tld->pc_mappingtable + PC_MAPPINGTABLE_SIZE);
-#endif
-
   /* initialize trampolines */
   tld->ret2app_trampoline = NULL;
   tld->opt_ijump_trampoline = NULL;
   tld->opt_icall_trampoline = NULL;
+#if defined(TARGET_REG_LOOKUP)
+  fbt_memset(tld->opt_ijump_reg_trampoline, 0,
+             sizeof(tld->opt_ijump_reg_trampoline));
+  fbt_memset(tld->opt_icall_reg_trampoline, 0,
+             sizeof(tld->opt_icall_reg_trampoline));
+#endif  /* TARGET_REG_LOOKUP */
   tld->unmanaged_code_trampoline = NULL;
   tld->opt_ret_trampoline = NULL;
   tld->opt_ret_remove_trampoline = NULL;
@@ -134,8 +159,78 @@ struct thread_local_data *fbt_reinit_tls(struct thread_local_data *tld) {
   tld->icf_predict = NULL;
 #endif  /* ICF_PREDICT */
 
+#if defined(SHADOW_STACK)
+  /* old entries point into the flushed code cache */
+  tld->shadow_top = 0;
+  fbt_memset(tld->shadow_stack, 0, sizeof(tld->shadow_stack));
+#endif  /* SHADOW_STACK */
+
+#if defined(RET_CACHE)
+  tld->opt_ret_cache_fixup = NULL;
+  tld->ret_caches = NULL;
+  tld->ret_caches_end = NULL;
+#endif  /* RET_CACHE */
+
+#if defined(PLT_CHAINING)
+  tld->opt_plt_fixup = NULL;
+#endif  /* PLT_CHAINING */
+
+#if defined(JUMP_TABLES)
+  tld->jump_tables = NULL;
+  tld->jump_table_entries = NULL;
+  tld->jump_table_entries_end = NULL;
+  tld->readonly_map_start = 0;
+  tld->readonly_map_end = 0;
+#endif  /* JUMP_TABLES */
+
 #if defined(AUTHORIZE_SYSCALLS)
   tld->syscall_location = NULL;
+#endif  /* AUTHORIZE_SYSCALLS */
+
+#if defined(HOT_TRACES)
+  tld->traces = NULL;
+  tld->trans.in_trace = 0;
+#endif  /* HOT_TRACES */
+
+#if defined(TIERED_TRANSLATION)
+  tld->tier_counters = NULL;
+  tld->tier_counters_end = NULL;
+  tld->trans.tier = 0;
+#endif  /* TIERED_TRANSLATION */
+
+#if defined(CCACHE_EVICTION)
+  tld->ccache_nr_chunks = 0;
+  tld->links = NULL;
+  tld->nr_links = 0;
+  tld->max_links = 0;
+#endif  /* CCACHE_EVICTION */
+
+#if defined(SHARED_CODE_CACHE)
+  /* mapping table, syscall table and code cache belong to the shared data, see
+     fbt_init_shared_data and fbt_attach_shared_data */
+  tld->mappingtable = NULL;
+  tld->syscall_table = NULL;
+#else
+  allocate_translation_data(tld);
+#endif  /* SHARED_CODE_CACHE */
+
+  return tld;
+}
+
+static void allocate_translation_data(struct thread_local_data *tld) {
+  /* allocate the mapping table, it grows later on if it gets too full */
+  tld->mappingtable = fbt_shared_smalloc(tld, sizeof(struct mapping_table));
+  fbt_memset(tld->mappingtable, 0, sizeof(struct mapping_table));
+  tld->mappingtable->table = fbt_allocate_mapping_table(tld, MAPPINGTABLE_SIZE);
+  tld->mappingtable->size = MAPPINGTABLE_SIZE;
+#ifdef __arm__
+  tld->pc_mappingtable = fbt_lalloc(tld, (PC_MAPPINGTABLE_SIZE / PAGESIZE) + 1,
+                                    MT_PC_MAPPING_TABLE);
+  PRINT_DEBUG("allocated pc_mappingtable: %p -> %p",
+              tld->pc_mappingtable, tld->pc_mappingtable + PC_MAPPINGTABLE_SIZE);
+#endif
+
+#if defined(AUTHORIZE_SYSCALLS)
   ulong_t table_size = (((MAX_SYSCALLS_TABLE*sizeof(void*)) + (PAGESIZE-1)) &
                         (~(PAGESIZE-1))) / PAGESIZE;
 
@@ -143,14 +238,31 @@ struct thread_local_data *fbt_reinit_tls(struct thread_local_data *tld) {
     (enum syscall_auth_response (**)(struct thread_local_data*, ulong_t,
                                      ulong_t, ulong_t, ulong_t, ulong_t,
                                      ulong_t, ulong_t*, ulong_t, ulong_t*))
-    fbt_lalloc(tld, table_size, MT_SYSCALL_TABLE);
+    fbt_shared_lalloc(tld, table_size, MT_SYSCALL_TABLE);
   assert(table_size == 1);
 #endif  /* AUTHORIZE_SYSCALLS */
 
+#if defined(EAGER_BACKPATCHING)
+  tld->trans.pending_trampos =
+    fbt_lalloc(tld, NRPAGES(PENDING_TRAMPOLINES_SIZE *
+                            sizeof(struct trampoline*)), MT_INTERNAL);
+#endif  /* EAGER_BACKPATCHING */
+
+#if defined(BATCH_TRANSLATION)
+  tld->trans.spec_queue = fbt_lalloc(tld, NRPAGES(BATCH_QUEUE_SIZE *
+                                                  sizeof(void*)), MT_INTERNAL);
+  tld->trans.spec_top = 0;
+  tld->trans.spec_count = 0;
+  tld->trans.speculative = 0;
+#endif  /* BATCH_TRANSLATION */
+
+#if defined(TRANSLATION_IR)
+  tld->trans.ir = fbt_lalloc(tld, NRPAGES(TRANSLATION_IR_SIZE *
+                                          sizeof(struct ir_instr)), MT_INTERNAL);
+#endif  /* TRANSLATION_IR */
+
   /* add code cache */
   fbt_allocate_new_code_cache(tld);
-
-  return tld;
 }
 
 void fbt_reinit_new_process(struct thread_local_data *tld) {
@@ -167,19 +279,40 @@ void fbt_reinit_new_process(struct thread_local_data *tld) {
   #endif /* SHARED_DATA */
 }
 
+void *fbt_allocate_mapping_table(struct thread_local_data *tld, ulong_t size) {
+  /* lalloc uses mmap and map_anonymous, so the table is initialized with 0x0
+     therefore we don't need to memset the whole table+4 for 0x1 guard for
+     tcache_find_fast asm function */
+  void *table = fbt_shared_lalloc(tld, (size / PAGESIZE) + 1, MT_MAPPING_TABLE);
+
+  /* guard for find_fast-wraparound used in optimizations */
+  *(long*)((long)(table) + size) = 0x1;
+
+  PRINT_DEBUG("allocated mappingtable: %p -> %p", table, table + size);
+  return table;
+}
+
 void fbt_allocate_new_code_cache(struct thread_local_data *tld) {
-  void *mem = fbt_lalloc(tld, CODE_CACHE_ALLOC_PAGES, MT_CODE_CACHE);
+  void *mem = fbt_shared_lalloc(tld, CODE_CACHE_ALLOC_PAGES, MT_CODE_CACHE);
   tld->trans.transl_instr = mem;
   tld->trans.code_cache_end = mem + (CODE_CACHE_ALLOC_PAGES * PAGESIZE) -
     TRANSL_GUARD;
+
+#if defined(CCACHE_EVICTION)
+  /* the oldest chunks are evicted at the next safe point (fbt_ccache_evict) */
+  if (tld->ccache_nr_chunks == CCACHE_MAX_CHUNKS + CCACHE_CHUNKS_SLACK) {
+    fbt_suicide_str("Too many code cache chunks without eviction "
+                    "(fbt_allocate_new_code_cache: fbt_mem_mgmt.c)\n");
+  }
+  tld->ccache_chunks[tld->ccache_nr_chunks++] = mem;
+#endif  /* CCACHE_EVICTION */
 }
 
 void fbt_allocate_new_trampolines(struct thread_local_data *tld) {
   ulong_t trampo_size = (((ALLOC_TRAMPOLINES * sizeof(struct trampoline)) +
                           (PAGESIZE-1)) & (~(PAGESIZE-1))) / PAGESIZE;
 
-  void *mem = fbt_lalloc(tld, trampo_size,
-MT_TRAMPOLINE);
+  void *mem = fbt_shared_lalloc(tld, trampo_size, MT_TRAMPOLINE);
   struct trampoline *trampos = (struct trampoline*)mem;
 
   /* initialize linked list */
@@ -195,16 +328,40 @@ MT_TRAMPOLINE);
 
 void fbt_trampoline_free(struct thread_local_data *tld,
                          struct trampoline *trampo) {
+#if defined(EAGER_BACKPATCHING)
+  fbt_untrack_trampoline(tld, trampo);
+#endif  /* EAGER_BACKPATCHING */
+#if defined(TRAMPOLINE_SHARING)
+  /* the other jumps must be linked first (see fbt_link_shared_origins) */
+  assert(trampo->origins == NULL);
+#endif  /* TRAMPOLINE_SHARING */
   trampo->next = tld->trans.trampos;
+  /* free trampolines have no origin (see fbt_ccache_evict) */
+  trampo->origin = NULL;
   tld->trans.trampos = trampo;
 }
 
+#if defined(TRAMPOLINE_SHARING)
+void fbt_allocate_new_trampoline_origins(struct thread_local_data *tld) {
+  struct trampoline_origin *origins = fbt_lalloc(tld, 1, MT_INTERNAL);
+
+  /* initialize linked list */
+  long i;
+  for (i = 0; i < (long)(ALLOC_TRAMPOLINE_ORIGINS - 1); ++i) {
+    origins[i].next = &origins[i + 1];
+  }
+  origins[i].next = tld->trans.free_origins;
+
+  tld->trans.free_origins = origins;
+}
+#endif  /* TRAMPOLINE_SHARING */
+
 #if defined(ICF_PREDICT)
 void fbt_allocate_new_icf_predictors(struct thread_local_data *tld) {
   ulong_t predict_size = (((ALLOC_PREDICTIONS * sizeof(struct icf_prediction)) +
                            (PAGESIZE-1)) & (~(PAGESIZE-1))) / PAGESIZE;
 
-  void *mem = fbt_lalloc(tld, predict_size, MT_ICF_PREDICT);
+  void *mem = fbt_shared_lalloc(tld, predict_size, MT_ICF_PREDICT);
   struct icf_prediction *icf_preds = (struct icf_prediction*)mem;
 
   /* initialize linked list */
@@ -221,13 +378,121 @@ void fbt_allocate_new_icf_predictors(struct thread_local_data *tld) {
 void fbt_icf_predictor_free(struct thread_local_data *tld,
                             struct icf_prediction *icf_predict) {
   icf_predict->pred.next = tld->icf_predict;
+  icf_predict->nrhits = 0;
   icf_predict->nrmispredict = 0;
-  icf_predict->origin1 = NULL;
-  icf_predict->dst1 = NULL;
+  icf_predict->state = ICF_PREDICTING;
+  icf_predict->megamorphic = NULL;
+  icf_predict->period = 0;
+  icf_predict->nrrearms = 0;
+  long i;
+  for (i = 0; i < ICF_PREDICT_WAYS; ++i) {
+    icf_predict->origin[i] = NULL;
+    icf_predict->dst[i] = NULL;
+  }
   tld->icf_predict = icf_predict;
 }
 #endif  /* ICF_PREDICT */
 
+#if defined(RET_CACHE)
+void fbt_allocate_new_ret_caches(struct thread_local_data *tld) {
+  tld->ret_caches = fbt_lalloc(tld, 1, MT_RET_CACHE);
+  tld->ret_caches_end = tld->ret_caches + PAGESIZE / sizeof(struct ret_cache);
+}
+#endif  /* RET_CACHE */
+
+#if defined(JUMP_TABLES)
+void fbt_allocate_new_jump_table_entries(struct thread_local_data *tld) {
+  tld->jump_table_entries = fbt_lalloc(tld, JUMP_TABLE_ALLOC_PAGES,
+                                       MT_INTERNAL);
+  tld->jump_table_entries_end = tld->jump_table_entries +
+    JUMP_TABLE_ALLOC_PAGES * PAGESIZE / sizeof(void*);
+}
+
+int fbt_mem_is_readonly(struct thread_local_data *tld, void *addr,
+                        ulong_t len) {
+  if (!PTR_IN_REGION(addr, tld->readonly_map_start,
+                     tld->readonly_map_end - tld->readonly_map_start)) {
+    long fd, ret;
+    fbt_open("/proc/self/maps", O_RDONLY, 0, fd);
+    if (fd < 0) {
+      return 0;
+    }
+
+    /* lines look like "08048000-08053000 r-xp 00000000 08:01 1234   /bin/ls",
+       we only parse the range and the write permission of each line */
+    char buf[256];
+    ulong_t start = 0, end = 0;
+    long field = 0, writable = 0, found = 0;
+    do {
+      fbt_read(fd, buf, sizeof(buf), ret);
+      long i;
+      for (i = 0; i < ret && !found; ++i) {
+        char c = buf[i];
+        if (c == '\n') {
+          found = field >= 4 && PTR_IN_REGION(addr, start, end - start);
+          if (found) {
+            tld->readonly_map_start = start;
+            tld->readonly_map_end = end;
+            tld->readonly_map = !writable;
+          }
+          start = end = 0;
+          field = writable = 0;
+        } else if (field == 0 || field == 1) {
+          /* start and end of the range */
+          ulong_t *value = (field == 0) ? &start : &end;
+          if (c >= '0' && c <= '9') {
+            *value = (*value << 4) | (c - '0');
+          } else if (c >= 'a' && c <= 'f') {
+            *value = (*value << 4) | (c - 'a' + 10);
+          } else {
+            field++;
+          }
+        } else if (field == 2 || field == 3) {
+          /* the first two permissions (r and w) */
+          writable |= (field == 3 && c != '-');
+          field++;
+        }
+      }
+    } while (ret > 0 && !found);
+    fbt_close(fd, ret);
+    if (!found) {
+      return 0;
+    }
+  }
+  return tld->readonly_map && (ulong_t)addr + len <= tld->readonly_map_end;
+}
+#endif  /* JUMP_TABLES */
+
+#if defined(BATCH_TRANSLATION)
+int fbt_mem_readable(void *addr, ulong_t len) {
+#if defined(SYS_process_vm_readv) && defined(__i386__)
+  /* struct iovec of the kernel */
+  struct {
+    void *base;
+    ulong_t len;
+  } local, remote;
+  unsigned char byte;
+  ulong_t page = (ulong_t)addr & ~(PAGESIZE - 1);
+  ulong_t end = (ulong_t)addr + len;
+  long pid, ret;
+  fbt_getpid(pid);
+  for (; page < end; page += PAGESIZE) {
+    local.base = &byte;
+    local.len = 1;
+    remote.base = (void*)page;
+    remote.len = 1;
+    fbt_process_vm_readv(pid, &local, 1, &remote, 1, 0, ret);
+    if (ret != 1) {
+      return 0;
+    }
+  }
+  return 1;
+#else
+  return 0;
+#endif  /* SYS_process_vm_readv && __i386__ */
+}
+#endif  /* BATCH_TRANSLATION */
+
 void fbt_mem_free(struct thread_local_data *tld) {
   assert(tld != NULL);
   long kbfreed = 0;
@@ -239,6 +504,13 @@ void fbt_mem_free(struct thread_local_data *tld) {
        problem and takes care of the last allocated chunk. */
     struct mem_info *next = chunk->next;
     kbfreed += chunk->size >> 10;
+#if defined(PERSISTENT_CCACHE)
+    if (fbt_pcache_find_region(chunk->ptr, chunk->size) != NULL) {
+      /* the region stays reserved, see fbt_find_bt_memory */
+      fbt_mmap(chunk->ptr, chunk->size, PROT_NONE,
+               MAP_PRIVATE|MAP_ANONYMOUS|MAP_FIXED|MAP_NORESERVE, -1, 0, ret);
+    } else
+#endif  /* PERSISTENT_CCACHE */
     fbt_munmap(chunk->ptr, chunk->size, ret);
     SYSCALL_SUCCESS_OR_SUICIDE_STR(
         ret, "BT failed to deallocate memory (fbt_mem_free: fbt_mem_mgmt.c)\n");
@@ -248,22 +520,50 @@ void fbt_mem_free(struct thread_local_data *tld) {
   PRINT_DEBUG("%d KB freed on fbt_mem_free", kbfreed);
 }
 
-void *fbt_lalloc(struct thread_local_data *tld, int pages,
-                 enum mem_type type) {
+static void *map_chunk(struct thread_local_data *tld __attribute__((unused)),
+                       ulong_t size, long prot, long map_flags) {
+  void *addr = NULL;
+#if defined(PERSISTENT_CCACHE)
+  /* the memory of the first thread goes to fixed addresses */
+  addr = fbt_pcache_reserve(tld, size);
+  if (addr != NULL) {
+    map_flags |= MAP_FIXED;
+  }
+#endif  /* PERSISTENT_CCACHE */
+  void *mem;
+  fbt_mmap(addr, size, prot, map_flags, -1, 0, mem);
+  return mem;
+}
+
+/**
+ * Maps a number of pages with the protection flags that fit the given type.
+ * @param tld thread local data that owns the memory
+ * @param pages how many pages to allocate
+ * @param type type of memory
+ * @return the address of the allocated, page aligned memory
+ */
+static void *map_pages(struct thread_local_data *tld, int pages,
+                       enum mem_type type) {
   assert(pages > 0);
   if (pages <= 0)
-    fbt_suicide_str("Trying to allocate 0 pages (fbt_lalloc: fbt_mem_mgmt.c)\n");
+    fbt_suicide_str("Trying to allocate 0 pages (map_pages: fbt_mem_mgmt.c)\n");
 
   /* TODO: add guard pages for stack, mapping table, code cache */
   int alloc_size = pages * PAGESIZE;
 
-  struct mem_info *chunk = fbt_smalloc(tld, sizeof(struct mem_info));
-
   /* what flags should we use for the current alloc? */
   long flags = 0;
+  long map_flags = MAP_PRIVATE|MAP_ANONYMOUS;
   switch (type) {
-    case MT_INTERNAL:
     case MT_MAPPING_TABLE:
+#if defined(LAZY_MAPPINGTABLE)
+      /* only the pages that are actually used get backed by memory */
+      map_flags |= MAP_NORESERVE;
+#endif  /* LAZY_MAPPINGTABLE */
+      flags = PROT_READ|PROT_WRITE;
+      break;
+
+    case MT_INTERNAL:
 #ifdef __arm__
     case MT_PC_MAPPING_TABLE:
 #endif
@@ -276,19 +576,34 @@ void *fbt_lalloc(struct thread_local_data *tld, int pages,
 #if defined(ICF_PREDICT)
     case MT_ICF_PREDICT:
 #endif  /* ICF_PREDICT */
+#if defined(RET_CACHE)
+    case MT_RET_CACHE:
+#endif  /* RET_CACHE */
       flags = PROT_READ|PROT_WRITE;
       break;
 
     case MT_CODE_CACHE:
     case MT_TRAMPOLINE:
+#if defined(HOT_TRACES)
+    case MT_TRACE_CACHE:
+#endif  /* HOT_TRACES */
       flags = PROT_READ|PROT_WRITE|PROT_EXEC;
       break;
   }
 
-  void *retval;
-  fbt_mmap(NULL, alloc_size, flags, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0, retval);
+  void *retval = map_chunk(tld, alloc_size, flags, map_flags);
   SYSCALL_SUCCESS_OR_SUICIDE_STR(
-      retval, "BT failed to allocate memory (fbt_lalloc: fbt_mem_mgmt.c)\n");
+      retval, "BT failed to allocate memory (map_pages: fbt_mem_mgmt.c)\n");
+  return retval;
+}
+
+void *fbt_lalloc(struct thread_local_data *tld, int pages,
+                 enum mem_type type) {
+  int alloc_size = pages * PAGESIZE;
+
+  struct mem_info *chunk = fbt_smalloc(tld, sizeof(struct mem_info));
+
+  void *retval = map_pages(tld, pages, type);
 
   /* we do not track shared data, as it should never be freed */
   int track_chunk = 1;
@@ -312,6 +627,24 @@ void *fbt_lalloc(struct thread_local_data *tld, int pages,
   return retval;
 }
 
+void fbt_lfree(struct thread_local_data *tld, void *ptr) {
+  struct mem_info **chunk = &(tld->chunk);
+  while (*chunk != NULL && (*chunk)->ptr != ptr) {
+    chunk = &((*chunk)->next);
+  }
+  if (*chunk == NULL) {
+    fbt_suicide_str("Trying to free unknown memory (fbt_lfree: "
+                    "fbt_mem_mgmt.c)\n");
+  }
+
+  long ret;
+  fbt_munmap((*chunk)->ptr, (*chunk)->size, ret);
+  SYSCALL_SUCCESS_OR_SUICIDE_STR(
+      ret, "BT failed to deallocate memory (fbt_lfree: fbt_mem_mgmt.c)\n");
+  /* the mem_info struct stays in the smalloc area */
+  *chunk = (*chunk)->next;
+}
+
 void *fbt_smalloc(struct thread_local_data *tld, long size) {
   /* ensure that we use smalloc only for small stuff */
   if (size > SMALLOC_MAX || size <= 0) {
@@ -319,9 +652,8 @@ void *fbt_smalloc(struct thread_local_data *tld, long size) {
   }
   /* do we need to allocate additional small memory space? */
   if (size > tld->smalloc_size) {
-    void *mem;
-    fbt_mmap(NULL, SMALLOC_PAGES * PAGESIZE, PROT_READ|PROT_WRITE,
-             MAP_PRIVATE|MAP_ANONYMOUS, -1, 0, mem);
+    void *mem = map_chunk(tld, SMALLOC_PAGES * PAGESIZE, PROT_READ|PROT_WRITE,
+                          MAP_PRIVATE|MAP_ANONYMOUS);
     SYSCALL_SUCCESS_OR_SUICIDE_STR(
         mem, "BT failed to allocate memory (fbt_smalloc: fbt_mem_mgmt.c)\n");
     tld->smalloc_size = SMALLOC_PAGES * PAGESIZE;
@@ -365,6 +697,160 @@ void fbt_init_shared_data(struct thread_local_data *tld) {
 
   tld->shared_data = sd;
 
+#if defined(SHARED_CODE_CACHE)
+  /* the rest of the page(s) of the shared data is used for the mem_info
+     structs of the shared chunks */
+  sd->smalloc = (void*)(sd + 1);
+  sd->smalloc_size = (NRPAGES(sizeof(struct shared_data)) * PAGESIZE) -
+    sizeof(struct shared_data);
+  sd->chunk = NULL;
+  sd->trampos = NULL;
+#if defined(ICF_PREDICT)
+  sd->icf_predict = NULL;
+#endif  /* ICF_PREDICT */
+  sd->nr_translations = 0;
+  fbt_mutex_init(&sd->ccache_mutex);
+
+  /* no other thread exists yet, so we can fill in the shared structures
+     without holding the lock */
+  allocate_translation_data(tld);
+  sd->mappingtable = tld->mappingtable;
+  sd->syscall_table = tld->syscall_table;
+  sd->transl_instr = tld->trans.transl_instr;
+  sd->code_cache_end = tld->trans.code_cache_end;
+
+  sd->tld_segment = -1;
+  fbt_set_tld_segment(tld);
+#endif  /* SHARED_CODE_CACHE */
+
   PRINT_DEBUG_FUNCTION_END("");
 }
 #endif /* SHARED_DATA */
+
+#if defined(SHARED_CODE_CACHE)
+void fbt_attach_shared_data(struct thread_local_data *tld,
+                            struct shared_data *sd) {
+  tld->shared_data = sd;
+  tld->mappingtable = sd->mappingtable;
+  tld->syscall_table = sd->syscall_table;
+  /* the allocation state is loaded in fbt_lock_code_cache */
+  tld->trans.transl_instr = NULL;
+  tld->trans.code_cache_end = NULL;
+  tld->trans.trampos = NULL;
+#if defined(ICF_PREDICT)
+  tld->icf_predict = NULL;
+#endif  /* ICF_PREDICT */
+}
+
+void fbt_set_tld_segment(struct thread_local_data *tld) {
+  struct shared_data *sd = tld->shared_data;
+  struct user_desc desc;
+  fbt_memset(&desc, 0, sizeof(struct user_desc));
+
+  /* the segment spans the whole address space so that negative offsets wrap
+     around to the secure stack below the tld */
+  desc.entry_number = sd->tld_segment;
+  desc.base_addr = (ulong_t)tld;
+  desc.limit = 0xfffff;
+  desc.seg_32bit = 1;
+  desc.limit_in_pages = 1;
+  desc.useable = 1;
+
+  long ret;
+  fbt_set_thread_area(&desc, ret);
+  SYSCALL_SUCCESS_OR_SUICIDE_STR(ret, "BT failed to set up the tld segment "
+                                 "(fbt_set_tld_segment: fbt_mem_mgmt.c)\n");
+
+  /* the kernel picks a free entry for the first thread, all other threads
+     reuse it (the entries are thread local) */
+  sd->tld_segment = desc.entry_number;
+  ulong_t selector = (desc.entry_number << 3) | 0x3;
+  __asm__ __volatile__("movl %0, %%fs" : : "r"(selector));
+}
+
+void fbt_lock_code_cache(struct thread_local_data *tld) {
+  struct shared_data *sd = tld->shared_data;
+  fbt_mutex_lock(&sd->ccache_mutex);
+
+  tld->trans.transl_instr = sd->transl_instr;
+  tld->trans.code_cache_end = sd->code_cache_end;
+  tld->trans.trampos = sd->trampos;
+#if defined(ICF_PREDICT)
+  tld->icf_predict = sd->icf_predict;
+#endif  /* ICF_PREDICT */
+}
+
+void fbt_unlock_code_cache(struct thread_local_data *tld) {
+  struct shared_data *sd = tld->shared_data;
+
+  sd->transl_instr = tld->trans.transl_instr;
+  sd->code_cache_end = tld->trans.code_cache_end;
+  sd->trampos = tld->trans.trampos;
+#if defined(ICF_PREDICT)
+  sd->icf_predict = tld->icf_predict;
+#endif  /* ICF_PREDICT */
+
+  fbt_mutex_unlock(&sd->ccache_mutex);
+}
+
+void *fbt_shared_smalloc(struct thread_local_data *tld, long size) {
+  struct shared_data *sd = tld->shared_data;
+  if (size > SMALLOC_MAX || size <= 0) {
+    fbt_suicide_str("Too much memory requested (fbt_shared_smalloc: "
+                    "fbt_mem_mgmt.c)\n");
+  }
+  if (sd->smalloc_size < size) {
+    sd->smalloc = map_pages(tld, 1, MT_SHARED_DATA);
+    sd->smalloc_size = PAGESIZE;
+  }
+  void *mem = sd->smalloc;
+  sd->smalloc += size;
+  sd->smalloc_size -= size;
+  return mem;
+}
+
+void *fbt_shared_lalloc(struct thread_local_data *tld, int pages,
+                        enum mem_type type) {
+  struct shared_data *sd = tld->shared_data;
+
+  /* the mem_info structs must outlive the thread that allocates the chunk */
+  struct mem_info *chunk = fbt_shared_smalloc(tld, sizeof(struct mem_info));
+
+  void *retval = map_pages(tld, pages, type);
+
+  chunk->ptr = retval;
+  chunk->size = pages * PAGESIZE;
+  chunk->type = type;
+  chunk->next = sd->chunk;
+  sd->chunk = chunk;
+  return retval;
+}
+#endif  /* SHARED_CODE_CACHE */
+
+struct mem_info *fbt_find_bt_memory(struct thread_local_data *tld, void *ptr,
+                                    ulong_t size) {
+  struct mem_info *mem_info = tld->chunk;
+  while (mem_info != NULL) {
+    if (OVERLAPPING_REGIONS(ptr, size, mem_info->ptr, mem_info->size)) {
+      return mem_info;
+    }
+    mem_info = mem_info->next;
+  }
+#if defined(SHARED_CODE_CACHE)
+  mem_info = tld->shared_data->chunk;
+  while (mem_info != NULL) {
+    if (OVERLAPPING_REGIONS(ptr, size, mem_info->ptr, mem_info->size)) {
+      return mem_info;
+    }
+    mem_info = mem_info->next;
+  }
+#endif  /* SHARED_CODE_CACHE */
+#if defined(PERSISTENT_CCACHE)
+  /* the rest of the region of the first thread is reserved for the BT, the
+     application must not map anything there (it would be overwritten by the
+     next chunk) */
+  return fbt_pcache_find_region(ptr, size);
+#else
+  return NULL;
+#endif  /* PERSISTENT_CCACHE */
+}
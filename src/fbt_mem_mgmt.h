@@ -49,6 +49,9 @@ struct trampoline;
 #if defined(ICF_PREDICT)
 struct icf_prediction;
 #endif  /* ICF_PREDICT */
+#if defined(TRAMPOLINE_SHARING)
+struct trampoline_origin;
+#endif  /* TRAMPOLINE_SHARING */
 
 /** Guard of 1/2page that is used in the code-cache for special optimizations.
    Generally we can stop translating after every single instruction. But if we
@@ -79,6 +82,17 @@ struct icf_prediction;
 #define ALLOC_PREDICTIONS (PAGESIZE/sizeof(struct icf_prediction))
 #endif  /* ICF_PREDICT */
 
+#if defined(TRAMPOLINE_SHARING)
+/* one page full of origins of shared trampolines */
+#define ALLOC_TRAMPOLINE_ORIGINS (PAGESIZE/sizeof(struct trampoline_origin))
+#endif  /* TRAMPOLINE_SHARING */
+
+#if defined(JUMP_TABLES)
+/** entries of translated jump tables are allocated in chunks of this many
+    pages (a jump table never spans two chunks) */
+#define JUMP_TABLE_ALLOC_PAGES 4
+#endif  /* JUMP_TABLES */
+
 /** different types for memory chunks */
 enum mem_type {
   MT_CODE_CACHE,  /**< code cache (RX[W]) */
@@ -92,7 +106,13 @@ enum mem_type {
 #if defined(ICF_PREDICT)
   MT_ICF_PREDICT,  /**< prediction for indirect control flows (R[W]) */
 #endif  /* ICD_PREDICT */
+#if defined(RET_CACHE)
+  MT_RET_CACHE,  /**< return caches of ret instructions (R[W]) */
+#endif  /* RET_CACHE */
   MT_TRAMPOLINE,  /**< trampolines to translate new code blocks (RX[W]) */
+#if defined(HOT_TRACES)
+  MT_TRACE_CACHE,  /**< traces of hot code and counter stubs (RX[W]) */
+#endif  /* HOT_TRACES */
   MT_INTERNAL,  /**< internally used memory (R[W]) */
 #if defined(SHARED_DATA)
   MT_SHARED_DATA, /** <  used for shared data (R[W]) */
@@ -148,6 +168,23 @@ void *fbt_smalloc(struct thread_local_data *tld, long size);
 void *fbt_lalloc(struct thread_local_data *tld, int pages,
                  enum mem_type type);
 
+/**
+ * Unmaps a chunk that was allocated with fbt_lalloc and removes it from the
+ * list of chunks of this thread.
+ * @param tld thread local data of the current thread
+ * @param ptr start of the chunk
+ */
+void fbt_lfree(struct thread_local_data *tld, void *ptr);
+
+/**
+ * Allocates a mapping table (including the guard after the table that stops
+ * the fast lookup).
+ * @param tld thread local data of the current thread
+ * @param size size of the table in bytes (a power of 2)
+ * @return the address of the table
+ */
+void *fbt_allocate_mapping_table(struct thread_local_data *tld, ulong_t size);
+
 /**
  * Allocate a new code cache and make it available in the TLD struct.
  * @param tld thread local data of the current thread
@@ -174,6 +211,15 @@ void fbt_allocate_new_trampolines(struct thread_local_data *tld);
 void fbt_trampoline_free(struct thread_local_data *tld,
                          struct trampoline *trampo);
 
+#if defined(TRAMPOLINE_SHARING)
+/**
+ * Allocate a new set of origins for shared trampolines and make them available
+ * in the TLD struct.
+ * @param tld thread local data of the current thread
+ */
+void fbt_allocate_new_trampoline_origins(struct thread_local_data *tld);
+#endif  /* TRAMPOLINE_SHARING */
+
 #if defined(ICF_PREDICT)
 /**
  * Allocate a new set of predictors for indirect control flow transfers and make
@@ -191,14 +237,133 @@ void fbt_icf_predictor_free(struct thread_local_data *tld,
                             struct icf_prediction *icf_predict);
 #endif  /* ICF_PREDICT */
 
+#if defined(RET_CACHE)
+/**
+ * Allocate a new page of return caches and make them available in the TLD
+ * struct.
+ * @param tld thread local data of the current thread
+ */
+void fbt_allocate_new_ret_caches(struct thread_local_data *tld);
+#endif  /* RET_CACHE */
+
+#if defined(JUMP_TABLES)
+/**
+ * Allocate a new chunk of entries for translated jump tables and make it
+ * available in the TLD struct.
+ * @param tld thread local data of the current thread
+ */
+void fbt_allocate_new_jump_table_entries(struct thread_local_data *tld);
+
+/**
+ * Checks in /proc/self/maps if a range of memory lies in a single mapping that
+ * is not writable. The mapping is remembered in the tld, further queries in
+ * the same mapping do not read the maps again (fbt_ccache_invalidate forgets
+ * the mapping once it changes).
+ * @param tld thread local data
+ * @param addr start of the range
+ * @param len length of the range in bytes
+ * @return 1 if the range is read-only, 0 otherwise (or if the maps cannot be
+ * read)
+ */
+int fbt_mem_is_readonly(struct thread_local_data *tld, void *addr,
+                        ulong_t len);
+#endif  /* JUMP_TABLES */
+
+#if defined(BATCH_TRANSLATION)
+/**
+ * Checks if all pages of a range of memory can be read without a fault. The
+ * check reads one byte per page through process_vm_readv, which reports
+ * unmapped and unreadable pages as an error instead of raising a signal.
+ * @param addr start of the range
+ * @param len length of the range in bytes
+ * @return 1 if the range is readable, 0 otherwise (also if the kernel lacks
+ * process_vm_readv)
+ */
+int fbt_mem_readable(void *addr, ulong_t len);
+#endif  /* BATCH_TRANSLATION */
+
 #ifdef SHARED_DATA
 /**
  * Initializes the shared data for this tld. This should only be done once and
  * the structure should then be passed on to created threads.
+ * With SHARED_CODE_CACHE this also allocates the mapping table, the syscall
+ * table and the code cache that are used by all threads.
  */
 void fbt_init_shared_data(struct thread_local_data* tld);
 #endif /* SHARED_DATA */
 
+#if defined(SHARED_CODE_CACHE)
+/**
+ * Connects the tld of a new thread to the shared code cache, mapping table and
+ * syscall table.
+ * @param tld thread local data of the new thread
+ * @param sd shared data of the process
+ */
+void fbt_attach_shared_data(struct thread_local_data *tld,
+                            struct shared_data *sd);
+
+/**
+ * Points the tld segment (%fs) of the calling thread to its tld. Code in the
+ * shared code cache reaches the thread local data through this segment.
+ * @param tld thread local data of the calling thread
+ */
+void fbt_set_tld_segment(struct thread_local_data *tld);
+
+/**
+ * Acquires the lock of the shared code cache and loads the shared allocation
+ * state (code cache position and free lists) into the tld. Everything that
+ * writes to the code cache or the mapping table must hold this lock.
+ * @param tld thread local data of the current thread
+ */
+void fbt_lock_code_cache(struct thread_local_data *tld);
+
+/**
+ * Stores the allocation state back into the shared data and releases the lock
+ * of the shared code cache.
+ * @param tld thread local data of the current thread
+ */
+void fbt_unlock_code_cache(struct thread_local_data *tld);
+
+/**
+ * Allocates size bytes of memory that is shared among all threads and is never
+ * freed. Must be called with the lock of the shared code cache held.
+ * @param tld thread local data of the current thread
+ * @param size number of bytes (must be smaller than SMALLOC_MAX)
+ * @return the address of the allocated (unaligned) memory
+ */
+void *fbt_shared_smalloc(struct thread_local_data *tld, long size);
+
+/**
+ * Allocates memory that is shared among all threads. The chunk is tracked in
+ * the shared data and is never freed. Must be called with the lock of the
+ * shared code cache held.
+ * @param tld thread local data of the current thread
+ * @param pages how many pages to allocate
+ * @param type type of memory (specifies the protection flags)
+ * @return the address of the allocated, page aligned memory
+ */
+void *fbt_shared_lalloc(struct thread_local_data *tld, int pages,
+                        enum mem_type type);
+#else
+/* every thread has its own code cache */
+#define fbt_lock_code_cache(tld)
+#define fbt_unlock_code_cache(tld)
+#define fbt_shared_smalloc(tld, size) fbt_smalloc((tld), (size))
+#define fbt_shared_lalloc(tld, pages, type) fbt_lalloc((tld), (pages), (type))
+#endif  /* SHARED_CODE_CACHE */
+
+/**
+ * Checks if a memory region overlaps with memory of the BT (including the
+ * memory that is shared among all threads and the region of the persistent
+ * code cache).
+ * @param tld thread local data of the current thread
+ * @param ptr start of the region
+ * @param size length of the region
+ * @return the first BT chunk that overlaps or NULL
+ */
+struct mem_info *fbt_find_bt_memory(struct thread_local_data *tld, void *ptr,
+                                    ulong_t size);
+
 #ifdef __cplusplus
 }
 #endif
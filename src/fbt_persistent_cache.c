@@ -0,0 +1,966 @@
+/**
+ * @file fbt_persistent_cache.c
+ * Persistent code cache: the translated code of the first thread is written to
+ * a file when the program exits and reused by the next run of the same
+ * program.
+ *
+ * All memory of the first thread is allocated at fixed addresses in a reserved
+ * region. The initialization of the BT is deterministic, so the tld, the stack,
+ * and the trampolines at the start of the code cache end up at the same
+ * addresses in every run. The code cache, trampolines, predictions, and the
+ * mapping table of the last run are mapped back to their old addresses and all
+ * addresses that the generated code holds stay valid without relocation.
+ * Nothing is relocated: the cache is rejected if the BT library or an object
+ * with translations is loaded at a different address (ASLR). Translations of
+ * objects that are not mapped any more or that changed are invalidated (see
+ * fbt_ccache_invalidate).
+ *
+ * Copyright (c) 2011 ETH Zurich
+ * @author Mathias Payer <mathias.payer@nebelwelt.net>
+ *
+ * $Date: 2011-12-30 14:24:05 +0100 (Fri, 30 Dec 2011) $
+ * $LastChangedDate: 2011-12-30 14:24:05 +0100 (Fri, 30 Dec 2011) $
+ * $LastChangedBy: payerm $
+ * $Revision: 1134 $
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301, USA.
+ */
+#include <asm-generic/fcntl.h>
+#include <asm-generic/mman.h>
+#include <asm/stat.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#include "fbt_persistent_cache.h"
+#include "fbt_code_cache.h"
+#include "fbt_datatypes.h"
+#include "fbt_debug.h"
+#include "fbt_mem_mgmt.h"
+#include "fbt_trampoline.h"
+#include "generic/fbt_algorithms.h"
+#include "generic/fbt_libc.h"
+#include "generic/fbt_llio.h"
+
+#if defined(PERSISTENT_CCACHE)
+
+#define PCACHE_MAGIC 0x43504246
+/** bump this if the layout of the file or of the BT data changes */
+#define PCACHE_VERSION 3
+/** we record at most this many mapped files */
+#define PCACHE_MAX_OBJECTS 256
+/** size of the buffer for /proc/self/maps */
+#define PCACHE_MAPS_PAGES 64
+/** size of the buffer for /proc/self/environ */
+#define PCACHE_ENVIRON_PAGES 16
+#define PCACHE_PATH_MAX 256
+
+/** file type bits of st_mode, asm/stat.h does not define them */
+#if !defined(S_IFDIR)
+# define S_IFMT 0170000
+# define S_IFDIR 0040000
+#endif
+
+/** true if a system call returned an error code */
+#define PCACHE_FAILED(res) ((ulong_t)(res) >= (ulong_t)-4095)
+
+/** identity of a file that is mapped into the address space */
+struct pcache_object {
+  uint64_t inode;
+  uint64_t size;
+  ulong_t dev;
+  /** first mapped address */
+  ulong_t start;
+  /** first address after the last mapping of the file */
+  ulong_t end;
+  /** set if the code cache holds translations of the file */
+  ulong_t translated;
+};
+
+/** a chunk of BT memory that is stored in the cache file */
+struct pcache_chunk {
+  void *ptr;
+  ulong_t size;
+  enum mem_type type;
+  /** offset of the data in the file (page aligned) */
+  ulong_t offset;
+};
+
+/** The file starts with the header, followed by the objects and the chunks.
+    The data of the chunks starts at the next page boundary. */
+struct pcache_header {
+  ulong_t magic;
+  ulong_t version;
+  ulong_t tld_size;
+  struct thread_local_data *tld;
+  /** the BT library itself. The mapping table holds addresses in the library
+      (e.g., the commit function), so it must be loaded at the same address. */
+  struct pcache_object bt;
+  /** end of the trampolines that are generated during the initialization */
+  Code *trampolines_end;
+  Code *transl_instr;
+  Code *code_cache_end;
+  struct trampoline *trampos;
+#if defined(ICF_PREDICT)
+  struct icf_prediction *icf_predict;
+#endif  /* ICF_PREDICT */
+#if defined(RET_CACHE)
+  struct ret_cache *ret_caches;
+  struct ret_cache *ret_caches_end;
+#endif  /* RET_CACHE */
+  struct mapping_table mappingtable;
+  /** end of the allocated part of the region */
+  void *alloc_end;
+  ulong_t nr_objects;
+  ulong_t nr_chunks;
+};
+
+static struct {
+  /** start of the region or NULL if the persistent cache is disabled */
+  void *base;
+  /** next free address in the region */
+  void *next;
+  /** end of the trampolines of the first thread (see fbt_pcache_load) */
+  Code *trampolines_end;
+  /** the whole region (see fbt_pcache_find_region) */
+  struct mem_info region;
+  int initialized;
+  int loaded;
+  int stored;
+} pcache;
+
+/** the region holds all memory of the first thread */
+static int owns(struct thread_local_data *tld) {
+  return pcache.base != NULL && PTR_IN_REGION(tld, pcache.base, PCACHE_SIZE);
+}
+
+void fbt_pcache_init() {
+  if (pcache.initialized) {
+    return;
+  }
+  pcache.initialized = 1;
+
+  void *mem;
+  fbt_mmap((void*)PCACHE_BASE, PCACHE_SIZE, PROT_NONE,
+           MAP_PRIVATE|MAP_ANONYMOUS|MAP_NORESERVE, -1, 0, mem);
+  if (PCACHE_FAILED(mem)) {
+    PRINT_DEBUG("persistent cache disabled, could not reserve the region");
+    return;
+  }
+  if (mem != (void*)PCACHE_BASE) {
+    /* the address is only a hint, something else lives there already */
+    long ret;
+    fbt_munmap(mem, PCACHE_SIZE, ret);
+    PRINT_DEBUG("persistent cache disabled, region %p is in use",
+                (void*)PCACHE_BASE);
+    return;
+  }
+  pcache.base = mem;
+  pcache.next = mem;
+  pcache.region.type = MT_INTERNAL;
+  pcache.region.next = NULL;
+  pcache.region.ptr = mem;
+  pcache.region.size = PCACHE_SIZE;
+}
+
+void *fbt_pcache_reserve(struct thread_local_data *tld, ulong_t size) {
+  if (pcache.base == NULL) {
+    return NULL;
+  }
+  /* the initial chunk goes to the start of the region, i.e., only the first
+     thread gets its tld there */
+  if ((tld == NULL && pcache.next != pcache.base) ||
+      (tld != NULL && !owns(tld))) {
+    return NULL;
+  }
+  if ((ulong_t)pcache.next + size > (ulong_t)pcache.base + PCACHE_SIZE) {
+    PRINT_DEBUG("persistent cache region is full");
+    return NULL;
+  }
+  void *mem = pcache.next;
+  pcache.next += size;
+  return mem;
+}
+
+struct mem_info *fbt_pcache_find_region(void *ptr, ulong_t size) {
+  if (pcache.base == NULL ||
+      !OVERLAPPING_REGIONS(ptr, size, pcache.base, PCACHE_SIZE)) {
+    return NULL;
+  }
+  return &pcache.region;
+}
+
+/**
+ * Maps scratch memory outside of the region.
+ * @param size size in bytes (page aligned)
+ * @return the memory or NULL
+ */
+static void *scratch_map(ulong_t size) {
+  void *mem;
+  fbt_mmap(NULL, size, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0,
+           mem);
+  return PCACHE_FAILED(mem) ? NULL : mem;
+}
+
+static void scratch_unmap(void *mem, ulong_t size) {
+  long ret;
+  fbt_munmap(mem, size, ret);
+}
+
+static int read_all(int fd, void *buf, ulong_t len) {
+  while (len > 0) {
+    long ret;
+    fbt_read(fd, buf, len, ret);
+    if (PCACHE_FAILED(ret) || ret == 0) {
+      return 0;
+    }
+    buf += ret;
+    len -= ret;
+  }
+  return 1;
+}
+
+static int write_all(int fd, const void *buf, ulong_t len) {
+  while (len > 0) {
+    long ret;
+    fbt_write(fd, buf, len, ret);
+    if (PCACHE_FAILED(ret) || ret == 0) {
+      return 0;
+    }
+    buf += ret;
+    len -= ret;
+  }
+  return 1;
+}
+
+static int seek(int fd, ulong_t offset) {
+  long ret;
+  fbt_lseek(fd, offset, SEEK_SET, ret);
+  return !PCACHE_FAILED(ret);
+}
+
+static ulong_t parse_hex(char **str) {
+  ulong_t value = 0;
+  for (;;) {
+    char c = **str;
+    if (c >= '0' && c <= '9') {
+      value = (value << 4) | (c - '0');
+    } else if (c >= 'a' && c <= 'f') {
+      value = (value << 4) | (c - 'a' + 10);
+    } else {
+      return value;
+    }
+    (*str)++;
+  }
+}
+
+static uint64_t parse_dec(char **str) {
+  uint64_t value = 0;
+  while (**str >= '0' && **str <= '9') {
+    value = value * 10 + (**str - '0');
+    (*str)++;
+  }
+  return value;
+}
+
+/**
+ * Reads a file of /proc into a buffer. The contents are terminated with a null
+ * byte and cut off at the end of the buffer.
+ * @param path the file
+ * @param buf the buffer
+ * @param size size of the buffer in bytes
+ * @return the number of bytes read
+ */
+static long read_proc(const char *path, char *buf, ulong_t size) {
+  long fd, len = 0, ret;
+  buf[0] = '\0';
+  fbt_open(path, O_RDONLY, 0, fd);
+  if (PCACHE_FAILED(fd)) {
+    return 0;
+  }
+  do {
+    fbt_read(fd, buf + len, size - 1 - len, ret);
+    if (PCACHE_FAILED(ret)) {
+      ret = 0;
+    }
+    len += ret;
+  } while (ret > 0 && (ulong_t)len < size - 1);
+  fbt_close(fd, ret);
+  buf[len] = '\0';
+  return len;
+}
+
+/**
+ * Collects the files that are mapped into the address space. All mappings of a
+ * file are merged into one object.
+ * @param maps buffer for /proc/self/maps (PCACHE_MAPS_PAGES pages)
+ * @param objects array of PCACHE_MAX_OBJECTS objects
+ * @return the number of objects
+ */
+static ulong_t read_objects(char *maps, struct pcache_object *objects) {
+  long ret;
+  read_proc("/proc/self/maps", maps, PCACHE_MAPS_PAGES * PAGESIZE);
+
+  /* lines look like "08048000-08053000 r-xp 00000000 08:01 1234   /bin/ls" */
+  ulong_t nr_objects = 0;
+  char *line = maps;
+  while (*line != '\0') {
+    char *eol = line;
+    while (*eol != '\n' && *eol != '\0') {
+      eol++;
+    }
+    if (*eol == '\0') {
+      /* the buffer ends in the middle of a line */
+      break;
+    }
+    *eol = '\0';
+
+    char *cur = line;
+    ulong_t start = parse_hex(&cur);
+    cur++;
+    ulong_t end = parse_hex(&cur);
+    /* skip the permissions and the offset */
+    cur++;
+    while (*cur != ' ' && *cur != '\0') {
+      cur++;
+    }
+    cur++;
+    parse_hex(&cur);
+    cur++;
+    ulong_t dev = parse_hex(&cur) << 16;
+    cur++;
+    dev |= parse_hex(&cur);
+    cur++;
+    uint64_t inode = parse_dec(&cur);
+    while (*cur == ' ') {
+      cur++;
+    }
+
+    if (inode == 0 || *cur != '/') {
+      /* anonymous memory, heap, stack, vdso */
+    } else if (nr_objects > 0 && objects[nr_objects - 1].inode == inode &&
+               objects[nr_objects - 1].dev == dev) {
+      objects[nr_objects - 1].end = end;
+    } else if (nr_objects < PCACHE_MAX_OBJECTS) {
+      /* the size tells us if the file was replaced in place */
+      struct stat64 st;
+      fbt_stat64(cur, &st, ret);
+      if (!PCACHE_FAILED(ret) && st.st_ino == inode) {
+        objects[nr_objects].inode = inode;
+        objects[nr_objects].size = st.st_size;
+        objects[nr_objects].dev = dev;
+        objects[nr_objects].start = start;
+        objects[nr_objects].end = end;
+        objects[nr_objects].translated = 0;
+        nr_objects++;
+      }
+    }
+    line = eol + 1;
+  }
+  return nr_objects;
+}
+
+/**
+ * Searches the object that contains the given address.
+ * @return the object or NULL
+ */
+static struct pcache_object *find_object(struct pcache_object *objects,
+                                         ulong_t nr_objects, void *addr) {
+  ulong_t i;
+  for (i = 0; i < nr_objects; ++i) {
+    if (PTR_IN_REGION(addr, objects[i].start,
+                      objects[i].end - objects[i].start)) {
+      return &objects[i];
+    }
+  }
+  return NULL;
+}
+
+static int same_file(struct pcache_object *a, struct pcache_object *b) {
+  return a->inode == b->inode && a->size == b->size && a->dev == b->dev;
+}
+
+/**
+ * Checks if a file with translations in the cache is now loaded at a
+ * different address (e.g., because of ASLR). The generated code is not
+ * relocated, so the cache is useless then.
+ * @return 1 if a file with translations moved
+ */
+static int objects_moved(struct pcache_object *recorded, ulong_t nr_recorded,
+                         struct pcache_object *current, ulong_t nr_current) {
+  ulong_t i, j;
+  for (i = 0; i < nr_recorded; ++i) {
+    if (!recorded[i].translated) {
+      continue;
+    }
+    for (j = 0; j < nr_current; ++j) {
+      if (same_file(&recorded[i], &current[j]) &&
+          recorded[i].start != current[j].start) {
+        PRINT_DEBUG("object at %p moved to %p", recorded[i].start,
+                    current[j].start);
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+#if !defined(PCACHE_DIR)
+/**
+ * Looks up a variable in the environment of the program.
+ * @param environ contents of /proc/self/environ
+ * @param len length of environ in bytes
+ * @param name name of the variable followed by '='
+ * @return the value or NULL if the variable is not set
+ */
+static char *find_env(char *environ, long len, const char *name) {
+  long name_len = fbt_strnlen(name, PCACHE_PATH_MAX);
+  char *var = environ;
+  while (var < environ + len) {
+    if (fbt_strncmp(var, name, name_len) == 0) {
+      return var + name_len;
+    }
+    var += fbt_strnlen(var, environ + len - var) + 1;
+  }
+  return NULL;
+}
+#endif  /* !PCACHE_DIR */
+
+/**
+ * Finds the directory for the cache files and creates it if necessary. We
+ * execute the code in the cache files, so the directory must belong to the
+ * user and nobody else may write to it.
+ * @param dir buffer of PCACHE_PATH_MAX bytes
+ * @return 1 on success
+ */
+static int cache_dir(char *dir) {
+  long ret, euid;
+#if defined(PCACHE_DIR)
+  llsnprintf(dir, PCACHE_PATH_MAX, "%s", PCACHE_DIR);
+#else
+  char *environ = scratch_map(PCACHE_ENVIRON_PAGES * PAGESIZE);
+  if (environ == NULL) {
+    return 0;
+  }
+  long len = read_proc("/proc/self/environ", environ,
+                       PCACHE_ENVIRON_PAGES * PAGESIZE);
+  /* leave room for the name of the cache file */
+  long max_len = PCACHE_PATH_MAX - 64;
+  char *base = find_env(environ, len, "XDG_CACHE_HOME=");
+  dir[0] = '\0';
+  if (base != NULL && base[0] == '/' && fbt_strnlen(base, max_len) < max_len) {
+    llsnprintf(dir, PCACHE_PATH_MAX, "%s/fastbt", base);
+  } else if ((base = find_env(environ, len, "HOME=")) != NULL &&
+             base[0] == '/' && fbt_strnlen(base, max_len) < max_len) {
+    llsnprintf(dir, PCACHE_PATH_MAX, "%s/.cache", base);
+    fbt_mkdir(dir, 0700, ret);
+    llsnprintf(dir, PCACHE_PATH_MAX, "%s/.cache/fastbt", base);
+  }
+  scratch_unmap(environ, PCACHE_ENVIRON_PAGES * PAGESIZE);
+  if (dir[0] == '\0') {
+    return 0;
+  }
+#endif  /* PCACHE_DIR */
+  /* fails if the directory exists already, then we check it below */
+  fbt_mkdir(dir, 0700, ret);
+
+  struct stat64 st;
+  fbt_lstat64(dir, &st, ret);
+  fbt_geteuid(euid);
+  return !PCACHE_FAILED(ret) && (st.st_mode & S_IFMT) == S_IFDIR &&
+    st.st_uid == (ulong_t)euid && (st.st_mode & 077) == 0;
+}
+
+/**
+ * Builds the name of the cache file of this program from the identity of the
+ * executable.
+ * @param path buffer of PCACHE_PATH_MAX bytes
+ * @return 1 on success
+ */
+static int cache_path(char *path) {
+  struct stat64 st;
+  long ret;
+  fbt_stat64("/proc/self/exe", &st, ret);
+  if (PCACHE_FAILED(ret)) {
+    return 0;
+  }
+  char dir[PCACHE_PATH_MAX];
+  if (!cache_dir(dir)) {
+    PRINT_DEBUG("no private directory for the cache files");
+    return 0;
+  }
+  uint32_t key[4] = { (uint32_t)st.st_dev, (uint32_t)st.st_ino,
+                      (uint32_t)(st.st_ino >> 32), (uint32_t)st.st_size };
+  llsnprintf(path, PCACHE_PATH_MAX, "%s/fastbt-%x.cache", dir,
+             fbt_hash(key, 4, PCACHE_VERSION));
+  return 1;
+}
+
+/** the chunks that hold translated code and its bookkeeping */
+static int persisted_chunk(struct mapping_table *mt, struct mem_info *chunk) {
+  switch (chunk->type) {
+    case MT_CODE_CACHE:
+    case MT_TRAMPOLINE:
+#if defined(ICF_PREDICT)
+    case MT_ICF_PREDICT:
+#endif  /* ICF_PREDICT */
+#if defined(RET_CACHE)
+    case MT_RET_CACHE:
+#endif  /* RET_CACHE */
+      return 1;
+    case MT_MAPPING_TABLE:
+      return chunk->ptr == mt->table;
+    case MT_INTERNAL:
+      return chunk->ptr == mt->fragments || chunk->ptr == mt->guest_pages;
+    default:
+      return 0;
+  }
+}
+
+static int compare_chunks(const void *a, const void *b) {
+  const struct pcache_chunk *ca = a;
+  const struct pcache_chunk *cb = b;
+  if (ca->ptr == cb->ptr) {
+    return 0;
+  }
+  return (ca->ptr < cb->ptr) ? -1 : 1;
+}
+
+static int page_is_zero(const ulong_t *page) {
+  ulong_t i;
+  for (i = 0; i < PAGESIZE / sizeof(ulong_t); ++i) {
+    if (page[i] != 0) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/**
+ * Writes a chunk to the file. Pages that are all zero (e.g., most of the
+ * mapping table) are skipped and end up as holes in the file.
+ * @return the end of the last page that was written (or offset)
+ */
+static ulong_t write_chunk(int fd, struct pcache_chunk *chunk, int *ok) {
+  ulong_t written_end = chunk->offset;
+  ulong_t page = 0;
+  while (page < chunk->size && *ok) {
+    while (page < chunk->size && page_is_zero(chunk->ptr + page)) {
+      page += PAGESIZE;
+    }
+    ulong_t run = page;
+    while (run < chunk->size && !page_is_zero(chunk->ptr + run)) {
+      run += PAGESIZE;
+    }
+    if (run > page) {
+      *ok = seek(fd, chunk->offset + page) &&
+        write_all(fd, chunk->ptr + page, run - page);
+      written_end = chunk->offset + run;
+    }
+    page = run;
+  }
+  return written_end;
+}
+
+void fbt_pcache_store(struct thread_local_data *tld) {
+  if (!owns(tld) || pcache.stored || pcache.trampolines_end == NULL) {
+    return;
+  }
+  pcache.stored = 1;
+  PRINT_DEBUG_FUNCTION_START("fbt_pcache_store(tld=%p)", tld);
+
+  struct mapping_table *mt = tld->mappingtable;
+  fbt_ccache_finish_migration(tld);
+
+  /* all chunks must be in the region, the trampolines of the initialization
+     must still be there (the code cache might have been flushed) */
+  ulong_t nr_chunks = 0;
+  int init_chunk = 0;
+  struct mem_info *chunk;
+  for (chunk = tld->chunk; chunk != NULL; chunk = chunk->next) {
+    if (!persisted_chunk(mt, chunk)) {
+      continue;
+    }
+    if (!PTR_IN_REGION(chunk->ptr, pcache.base, PCACHE_SIZE)) {
+      PRINT_DEBUG_FUNCTION_END("-> chunk %p outside of the region", chunk->ptr);
+      return;
+    }
+    if (chunk->type == MT_CODE_CACHE &&
+        PTR_IN_REGION(pcache.trampolines_end, chunk->ptr, chunk->size)) {
+      init_chunk = 1;
+    }
+    nr_chunks++;
+  }
+  if (!init_chunk) {
+    PRINT_DEBUG_FUNCTION_END("-> initial code cache is gone");
+    return;
+  }
+
+  ulong_t meta_size = sizeof(struct pcache_header) +
+    PCACHE_MAX_OBJECTS * sizeof(struct pcache_object) +
+    nr_chunks * sizeof(struct pcache_chunk);
+  ulong_t scratch_size = (PCACHE_MAPS_PAGES + NRPAGES(meta_size)) * PAGESIZE;
+  void *scratch = scratch_map(scratch_size);
+  if (scratch == NULL) {
+    PRINT_DEBUG_FUNCTION_END("-> out of memory");
+    return;
+  }
+  char *maps = scratch;
+  struct pcache_header *header = scratch + PCACHE_MAPS_PAGES * PAGESIZE;
+  struct pcache_object *objects = (struct pcache_object*)(header + 1);
+
+  header->nr_objects = read_objects(maps, objects);
+  struct pcache_object *bt = find_object(objects, header->nr_objects,
+                                         (void*)&fbt_pcache_store);
+  if (bt == NULL) {
+    scratch_unmap(scratch, scratch_size);
+    PRINT_DEBUG_FUNCTION_END("-> BT library not found");
+    return;
+  }
+  ulong_t i;
+  for (i = 0; i < header->nr_objects; ++i) {
+    objects[i].translated = fbt_ccache_has_guest(tld, (void*)objects[i].start,
+                                                 objects[i].end -
+                                                 objects[i].start);
+  }
+
+  header->magic = PCACHE_MAGIC;
+  header->version = PCACHE_VERSION;
+  header->tld_size = sizeof(struct thread_local_data);
+  header->tld = tld;
+  header->bt = *bt;
+  header->trampolines_end = pcache.trampolines_end;
+  header->transl_instr = tld->trans.transl_instr;
+  header->code_cache_end = tld->trans.code_cache_end;
+  header->trampos = tld->trans.trampos;
+#if defined(ICF_PREDICT)
+  header->icf_predict = tld->icf_predict;
+#endif  /* ICF_PREDICT */
+#if defined(RET_CACHE)
+  header->ret_caches = tld->ret_caches;
+  header->ret_caches_end = tld->ret_caches_end;
+#endif  /* RET_CACHE */
+  header->mappingtable = *mt;
+  header->alloc_end = pcache.next;
+  header->nr_chunks = nr_chunks;
+
+  struct pcache_chunk *chunks =
+    (struct pcache_chunk*)(objects + header->nr_objects);
+  i = 0;
+  for (chunk = tld->chunk; chunk != NULL; chunk = chunk->next) {
+    if (persisted_chunk(mt, chunk)) {
+      chunks[i].ptr = chunk->ptr;
+      chunks[i].size = chunk->size;
+      chunks[i].type = chunk->type;
+      i++;
+    }
+  }
+  fbt_qsort(chunks, nr_chunks, sizeof(struct pcache_chunk), compare_chunks);
+  ulong_t offset = NRPAGES((ulong_t)(chunks + nr_chunks) - (ulong_t)header) *
+    PAGESIZE;
+  for (i = 0; i < nr_chunks; ++i) {
+    chunks[i].offset = offset;
+    offset += chunks[i].size;
+  }
+
+  /* write to a temporary file and rename it, a concurrent run either sees the
+     old or the new file */
+  char path[PCACHE_PATH_MAX], tmp_path[PCACHE_PATH_MAX];
+  long fd, pid, ret;
+  fbt_getpid(pid);
+  if (!cache_path(path)) {
+    scratch_unmap(scratch, scratch_size);
+    PRINT_DEBUG_FUNCTION_END("-> executable not found");
+    return;
+  }
+  llsnprintf(tmp_path, PCACHE_PATH_MAX, "%s.%d", path, pid);
+  fbt_open(tmp_path, O_WRONLY|O_CREAT|O_EXCL|O_NOFOLLOW, 0600, fd);
+  if (PCACHE_FAILED(fd)) {
+    scratch_unmap(scratch, scratch_size);
+    PRINT_DEBUG_FUNCTION_END("-> could not create %s", tmp_path);
+    return;
+  }
+
+  int ok = write_all(fd, header, (ulong_t)(chunks + nr_chunks) -
+                     (ulong_t)header);
+  ulong_t written_end = 0;
+  for (i = 0; i < nr_chunks && ok; ++i) {
+    written_end = write_chunk(fd, &chunks[i], &ok);
+  }
+  if (ok && written_end < offset) {
+    /* the file must cover the last chunk, otherwise we can not map it */
+    char zero = 0;
+    ok = seek(fd, offset - 1) && write_all(fd, &zero, 1);
+  }
+  fbt_close(fd, ret);
+
+  if (ok) {
+    fbt_rename(tmp_path, path, ret);
+    ok = !PCACHE_FAILED(ret);
+  }
+  if (!ok) {
+    fbt_unlink(tmp_path, ret);
+  }
+  scratch_unmap(scratch, scratch_size);
+  PRINT_DEBUG_FUNCTION_END("-> %s %s (%d chunks, %d KB)",
+                           ok ? "stored" : "failed to store", path, nr_chunks,
+                           offset >> 10);
+}
+
+/**
+ * Searches the chunk of the tld that matches a chunk of the file.
+ * @return 1 if the tld has exactly this chunk
+ */
+static int has_chunk(struct thread_local_data *tld, struct pcache_chunk *c) {
+  struct mem_info *chunk;
+  for (chunk = tld->chunk; chunk != NULL; chunk = chunk->next) {
+    if (chunk->ptr == c->ptr && (ulong_t)chunk->size == c->size &&
+        chunk->type == c->type) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * Checks the chunks of the file before we touch anything. Chunks below the
+ * current end of the region must already exist (they were allocated during the
+ * initialization), the others must fit into the free part of the region.
+ * @return 1 if the chunks can be loaded
+ */
+static int check_chunks(struct thread_local_data *tld,
+                        struct pcache_header *header,
+                        struct pcache_chunk *chunks, uint64_t file_size) {
+  if ((ulong_t)header->alloc_end < (ulong_t)pcache.next ||
+      !PTR_IN_REGION(header->alloc_end - 1, pcache.base, PCACHE_SIZE)) {
+    return 0;
+  }
+  void *end = pcache.base;
+  int init_chunk = 0;
+  ulong_t i;
+  for (i = 0; i < header->nr_chunks; ++i) {
+    struct pcache_chunk *c = &chunks[i];
+    if (c->ptr < end || c->size == 0 || (c->size & (PAGESIZE-1)) != 0 ||
+        ((ulong_t)c->ptr & (PAGESIZE-1)) != 0 ||
+        (c->offset & (PAGESIZE-1)) != 0 || c->offset + c->size > file_size ||
+        c->ptr + c->size > header->alloc_end) {
+      return 0;
+    }
+    end = c->ptr + c->size;
+    if (c->ptr < pcache.next && !has_chunk(tld, c)) {
+      return 0;
+    }
+    if (c->type == MT_CODE_CACHE &&
+        PTR_IN_REGION(header->trampolines_end, c->ptr, c->size)) {
+      init_chunk = c->ptr < pcache.next;
+    }
+    switch (c->type) {
+      case MT_CODE_CACHE:
+      case MT_TRAMPOLINE:
+#if defined(ICF_PREDICT)
+      case MT_ICF_PREDICT:
+#endif  /* ICF_PREDICT */
+#if defined(RET_CACHE)
+      case MT_RET_CACHE:
+#endif  /* RET_CACHE */
+      case MT_MAPPING_TABLE:
+      case MT_INTERNAL:
+        break;
+      default:
+        return 0;
+    }
+  }
+  return init_chunk;
+}
+
+/**
+ * Maps the chunks of the file to their old addresses. The trampolines of the
+ * initialization at the start of the first code cache are kept.
+ */
+static void load_chunks(struct thread_local_data *tld, long fd,
+                        struct pcache_header *header,
+                        struct pcache_chunk *chunks) {
+  ulong_t i;
+  for (i = 0; i < header->nr_chunks; ++i) {
+    struct pcache_chunk *c = &chunks[i];
+    if (c->ptr < pcache.next) {
+      ulong_t skip = 0;
+      if (PTR_IN_REGION(header->trampolines_end, c->ptr, c->size)) {
+        skip = (ulong_t)header->trampolines_end - (ulong_t)c->ptr;
+      }
+      if (!seek(fd, c->offset + skip) ||
+          !read_all(fd, c->ptr + skip, c->size - skip)) {
+        fbt_suicide_str("Failed to read the persistent code cache "
+                        "(load_chunks: fbt_persistent_cache.c)\n");
+      }
+      continue;
+    }
+
+    /* allocate the chunk at its old address and map the file over it */
+    pcache.next = c->ptr;
+    void *mem = fbt_lalloc(tld, c->size / PAGESIZE, c->type);
+    long prot = PROT_READ|PROT_WRITE;
+    if (c->type == MT_CODE_CACHE || c->type == MT_TRAMPOLINE) {
+      prot |= PROT_EXEC;
+    }
+    if (mem == c->ptr) {
+      fbt_mmap(c->ptr, c->size, prot, MAP_PRIVATE|MAP_FIXED, fd, c->offset,
+               mem);
+    }
+    if (mem != c->ptr) {
+      fbt_suicide_str("Failed to map the persistent code cache "
+                      "(load_chunks: fbt_persistent_cache.c)\n");
+    }
+  }
+  pcache.next = header->alloc_end;
+}
+
+/**
+ * Invalidates all translations outside of the objects that are still mapped at
+ * the same address.
+ */
+static void invalidate_objects(struct thread_local_data *tld,
+                               struct pcache_object *recorded,
+                               ulong_t nr_recorded,
+                               struct pcache_object *current,
+                               ulong_t nr_current) {
+  ulong_t gap = 0, i, j;
+  for (i = 0; i < nr_recorded; ++i) {
+    int valid = 0;
+    for (j = 0; j < nr_current && !valid; ++j) {
+      valid = same_file(&recorded[i], &current[j]) &&
+        recorded[i].start == current[j].start &&
+        recorded[i].end == current[j].end;
+    }
+    if (!valid) {
+      continue;
+    }
+    if (recorded[i].start > gap) {
+      fbt_ccache_invalidate(tld, (void*)gap, recorded[i].start - gap);
+    }
+    gap = recorded[i].end;
+  }
+  fbt_ccache_invalidate(tld, (void*)gap, ((ulong_t)-1) - gap);
+}
+
+void fbt_pcache_load(struct thread_local_data *tld) {
+  if (!owns(tld) || pcache.loaded) {
+    return;
+  }
+  pcache.loaded = 1;
+  /* everything up to here is the same in every run */
+  pcache.trampolines_end = tld->trans.transl_instr;
+  PRINT_DEBUG_FUNCTION_START("fbt_pcache_load(tld=%p)", tld);
+
+  char path[PCACHE_PATH_MAX];
+  long fd, ret, euid;
+  if (!cache_path(path)) {
+    PRINT_DEBUG_FUNCTION_END("-> executable not found");
+    return;
+  }
+  fbt_open(path, O_RDONLY|O_NOFOLLOW, 0, fd);
+  if (PCACHE_FAILED(fd)) {
+    PRINT_DEBUG_FUNCTION_END("-> no cache file %s", path);
+    return;
+  }
+
+  /* we execute the code in the file, so nobody else may write it */
+  struct stat64 st;
+  fbt_fstat64(fd, &st, ret);
+  fbt_geteuid(euid);
+  struct pcache_header header;
+  if (PCACHE_FAILED(ret) || st.st_uid != (ulong_t)euid ||
+      (st.st_mode & 022) != 0 || !read_all(fd, &header, sizeof(header)) ||
+      header.magic != PCACHE_MAGIC || header.version != PCACHE_VERSION ||
+      header.tld_size != sizeof(struct thread_local_data) ||
+      header.tld != tld || header.trampolines_end != pcache.trampolines_end ||
+      header.nr_objects > PCACHE_MAX_OBJECTS ||
+      header.nr_chunks > PCACHE_SIZE / PAGESIZE ||
+      tld->trans.trampos != NULL
+#if defined(ICF_PREDICT)
+      || tld->icf_predict != NULL
+#endif  /* ICF_PREDICT */
+#if defined(RET_CACHE)
+      || tld->ret_caches != NULL
+#endif  /* RET_CACHE */
+      ) {
+    fbt_close(fd, ret);
+    PRINT_DEBUG_FUNCTION_END("-> %s does not fit", path);
+    return;
+  }
+
+  ulong_t meta_size = header.nr_objects * sizeof(struct pcache_object) +
+    header.nr_chunks * sizeof(struct pcache_chunk);
+  ulong_t scratch_size = (PCACHE_MAPS_PAGES +
+                          NRPAGES(PCACHE_MAX_OBJECTS *
+                                  sizeof(struct pcache_object)) +
+                          NRPAGES(meta_size)) * PAGESIZE;
+  void *scratch = scratch_map(scratch_size);
+  if (scratch == NULL) {
+    fbt_close(fd, ret);
+    PRINT_DEBUG_FUNCTION_END("-> out of memory");
+    return;
+  }
+  char *maps = scratch;
+  struct pcache_object *current = scratch + PCACHE_MAPS_PAGES * PAGESIZE;
+  struct pcache_object *recorded = (struct pcache_object*)
+    ((void*)current + NRPAGES(PCACHE_MAX_OBJECTS *
+                              sizeof(struct pcache_object)) * PAGESIZE);
+  struct pcache_chunk *chunks =
+    (struct pcache_chunk*)(recorded + header.nr_objects);
+
+  ulong_t nr_current = read_objects(maps, current);
+  struct pcache_object *bt = find_object(current, nr_current,
+                                         (void*)&fbt_pcache_load);
+  if (bt == NULL || !same_file(bt, &header.bt) ||
+      bt->start != header.bt.start || !read_all(fd, recorded, meta_size) ||
+      objects_moved(recorded, header.nr_objects, current, nr_current) ||
+      !check_chunks(tld, &header, chunks, st.st_size)) {
+    fbt_close(fd, ret);
+    scratch_unmap(scratch, scratch_size);
+    PRINT_DEBUG_FUNCTION_END("-> %s does not fit", path);
+    return;
+  }
+
+  /* from here on we overwrite the state of the BT */
+  void *init_table = tld->mappingtable->table;
+  load_chunks(tld, fd, &header, chunks);
+  fbt_close(fd, ret);
+
+  tld->trans.transl_instr = header.transl_instr;
+  tld->trans.code_cache_end = header.code_cache_end;
+  tld->trans.trampos = header.trampos;
+#if defined(ICF_PREDICT)
+  tld->icf_predict = header.icf_predict;
+#endif  /* ICF_PREDICT */
+#if defined(RET_CACHE)
+  tld->ret_caches = header.ret_caches;
+  tld->ret_caches_end = header.ret_caches_end;
+#endif  /* RET_CACHE */
+  *tld->mappingtable = header.mappingtable;
+  if (tld->mappingtable->table != init_table) {
+    /* the table grew in the last run, the lookup trampolines of the
+       initialization still probe the initial table */
+    fbt_lfree(tld, init_table);
+    fbt_update_lookup_trampolines(tld);
+  }
+
+  invalidate_objects(tld, recorded, header.nr_objects, current, nr_current);
+  scratch_unmap(scratch, scratch_size);
+  PRINT_DEBUG_FUNCTION_END("-> loaded %s (%d entries)", path,
+                           tld->mappingtable->nr_entries);
+}
+
+#endif  /* PERSISTENT_CCACHE */
@@ -0,0 +1,112 @@
+/**
+ * @file fbt_persistent_cache.h
+ * Persistent code cache: the translated code of the first thread is written to
+ * a file when the program exits and reused by the next run of the same
+ * program.
+ *
+ * Copyright (c) 2011 ETH Zurich
+ * @author Mathias Payer <mathias.payer@nebelwelt.net>
+ *
+ * $Date: 2011-12-30 14:24:05 +0100 (Fri, 30 Dec 2011) $
+ * $LastChangedDate: 2011-12-30 14:24:05 +0100 (Fri, 30 Dec 2011) $
+ * $LastChangedBy: payerm $
+ * $Revision: 1134 $
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301, USA.
+ */
+#ifndef FBT_PERSISTENT_CACHE_H
+#define FBT_PERSISTENT_CACHE_H
+
+#include "fbt_datatypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(PERSISTENT_CCACHE)
+
+/** The memory of the first thread (tld, code cache, trampolines, mapping
+    table, ...) is allocated at fixed addresses in this region. The code cache
+    of the last run is then mapped back to the same addresses and can be used
+    without relocating any of the generated code. */
+#if !defined(PCACHE_BASE)
+# define PCACHE_BASE 0x40000000
+#endif
+#if !defined(PCACHE_SIZE)
+# define PCACHE_SIZE 0x10000000
+#endif
+
+/** Directory that holds the cache files (one file per executable). If it is not
+    set then the files go to $XDG_CACHE_HOME/fastbt or $HOME/.cache/fastbt.
+    The directory is created with mode 0700 and is only used if it belongs to
+    the user and nobody else can write to it. */
+/* #define PCACHE_DIR "/var/cache/fastbt" */
+
+/* forward declare structs */
+struct thread_local_data;
+
+/**
+ * Reserves the region for the memory of the first thread. If the region is not
+ * available then the persistent cache is disabled. Only the first call has an
+ * effect.
+ */
+void fbt_pcache_init();
+
+/**
+ * Returns a fixed address for a new chunk of memory if the chunk belongs to the
+ * first thread. The caller maps the chunk with MAP_FIXED.
+ * @param tld thread local data that owns the chunk or NULL for the initial
+ * chunk of a new thread (that holds the tld itself)
+ * @param size size of the chunk in bytes (page aligned)
+ * @return address in the region or NULL if the chunk is allocated elsewhere
+ */
+void *fbt_pcache_reserve(struct thread_local_data *tld, ulong_t size);
+
+/**
+ * Checks if a memory region overlaps the region of the persistent cache. The
+ * whole region is BT memory, also the part that is not allocated yet, because
+ * fbt_pcache_reserve hands it out for MAP_FIXED mappings.
+ * @param ptr start of the memory region
+ * @param size length of the memory region
+ * @return a chunk that describes the whole region or NULL
+ */
+struct mem_info *fbt_pcache_find_region(void *ptr, ulong_t size);
+
+/**
+ * Loads the code cache of the last run of this program. Must be called after
+ * the initialization of the first thread and before the first translation.
+ * The cache is not used if the BT library or a file with translations is
+ * loaded at a different address than in the last run. Translations of code
+ * that is no longer mapped (or that belongs to a different file) are
+ * invalidated.
+ * @param tld thread local data
+ */
+void fbt_pcache_load(struct thread_local_data *tld);
+
+/**
+ * Writes the code cache of the first thread to the cache file of this program.
+ * Has no effect for other threads or if the cache was already stored.
+ * @param tld thread local data
+ */
+void fbt_pcache_store(struct thread_local_data *tld);
+
+#endif  /* PERSISTENT_CCACHE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* FBT_PERSISTENT_CACHE_H */
@@ -33,11 +33,15 @@
 #include <stddef.h>
 #include <ucontext.h>
 #include <linux/sched.h>
+#include <asm-generic/mman.h>
 
 #include "fbt_code_cache.h"
 #include "fbt_datatypes.h"
 #include "fbt_debug.h"
 #include "fbt_mem_mgmt.h"
+#if defined(PERSISTENT_CCACHE)
+# include "fbt_persistent_cache.h"
+#endif
 #include "fbt_translate.h"
 #include "libfastbt.h"
 #include "generic/fbt_libc.h"
@@ -52,7 +56,7 @@ SYS_ptrace             deny
 SYS_signal             installs a new signal handler (deprecated)
 SYS_sigaction          installs a new signal handler
 SYS_mmap               redirected to auth_mmap
-SYS_munmap             TODO
+SYS_munmap             redirected to auth_munmap
 SYS_fstat              old fstat syscall, used by fbt_dso.c
 SYS_stat64             use new fstat syscall
 SYS_fstat64            use new fstat syscall
@@ -165,10 +169,25 @@ static enum syscall_auth_response auth_mmap2(struct thread_local_data *tld,
                                              ulong_t *retval);
 #endif  // SYS_mmap2
 
+/**
+ * Checks the parameters of a munmap and ensures that the region does not
+ * overlap with any BT region. Translations of code in the region are
+ * invalidated.
+ * @return Allows the system call if parameters are OK.
+ */
+static enum syscall_auth_response auth_munmap(struct thread_local_data *tld,
+                                              ulong_t syscall_nr, ulong_t arg1,
+                                              ulong_t arg2, ulong_t arg3,
+                                              ulong_t arg4, ulong_t arg5,
+                                              ulong_t *arg6,
+                                              ulong_t is_sysenter,
+                                              ulong_t *retval);
+
 /**
  * Checks the parameters of an mprotect and ensures that the application does
  * not have access to any BT region. It also checks if new code is marked
- * executable.
+ * executable. Translations of code in the region are invalidated if the region
+ * becomes writable or not executable.
  * @return Allows the system call if parameters are OK.
  */
 static enum syscall_auth_response auth_mprotect(struct thread_local_data *tld,
@@ -228,6 +247,10 @@ static enum syscall_auth_response auth_exit(struct thread_local_data *tld,
 #if defined(HANDLE_SIGNALS)
 
 void fbt_bootstrap_thread(struct thread_local_data *tld) {
+#if defined(SHARED_CODE_CACHE)
+  /* the new thread inherited the tld segment of its parent */
+  fbt_set_tld_segment(tld);
+#endif  /* SHARED_CODE_CACHE */
 #if defined(SHARED_DATA)
   PRINT_DEBUG("Adding new thread to thread list...\n");
   /* Add thread to our list */
@@ -420,6 +443,11 @@ static enum syscall_auth_response auth_clone(struct thread_local_data *tld,
     /* jump over that int 0x80 or sysenter instruction (both are 2bytes long) */
     void *syscall_location = (void*)(((ulong_t)tld->syscall_location)+2);
 
+#if defined(SHARED_CODE_CACHE)
+    /* the new thread uses the code cache and the mapping table of this thread,
+       the entries for the transaction functions are already in place */
+    struct thread_local_data *new_threads_tld = fbt_init_thread(tld);
+#else
     /* initialize new BT data structures for the new thread */
     struct thread_local_data *new_threads_tld = fbt_init(NULL);
 
@@ -434,12 +462,15 @@ static enum syscall_auth_response auth_clone(struct thread_local_data *tld,
 #if defined(HIJACKCONTROL)
     fbt_ccache_add_entry(new_threads_tld, (void*)fbt_exit, (void*)fbt_exit);
 #endif  /* HIJACKCONTROL */
+#endif  /* SHARED_CODE_CACHE */
 
     /* translate the TU if not already in tcache */
     ulong_t *childsp = (ulong_t*)(arg2 - sizeof(void*));
+    fbt_lock_code_cache(new_threads_tld);
     struct trampoline *trampo = fbt_create_trampoline(new_threads_tld,
                                                       syscall_location, childsp,
                                                       ORIGIN_CLEAR);
+    fbt_unlock_code_cache(new_threads_tld);
     #if defined(SHARED_DATA)
     /* start thread through bootstrapping trampoline */
     new_threads_tld->ind_target = trampo;
@@ -519,6 +550,18 @@ static enum syscall_auth_response auth_exit(struct thread_local_data *tld,
     (syscall_nr == SYS_exit ? "exit" : "exit_group")
   );
 #endif
+#if defined(DEBUG) || defined(PRINT_STATISTICS)
+#if defined(SHARED_CODE_CACHE)
+  llprintf("shared code cache: %d TUs translated by all threads\n",
+           tld->shared_data->nr_translations);
+#endif  /* SHARED_CODE_CACHE */
+  fbt_ccache_print_statistics(tld);
+#endif
+
+#if defined(PERSISTENT_CCACHE)
+  /* only stores the code cache if this is the first thread */
+  fbt_pcache_store(tld);
+#endif  /* PERSISTENT_CCACHE */
 
 #if defined(SHARED_DATA)
   /* Make sure our list of threads reflects thread termination */
@@ -714,20 +757,17 @@ auth_mmap(struct thread_local_data *tld __attribute__((unused)),
   /* TODO: add check for regions of elf files */
 
   /* ensure we don't remap memory structures of the BT */
-  struct mem_info *mem_info = tld->chunk;
   void *startptr = (void*)arg1;
   ulong_t size = arg2;
   if (startptr != NULL) {
-    while (mem_info != NULL) {
-      if (OVERLAPPING_REGIONS(startptr, size, mem_info->ptr, mem_info->size)) {
-        PRINT_DEBUG("Application got access to internal data and tries to " \
-                    "mmap  our memory. Access rejected. Address: %p, length: " \
-                    "%d\nMem_info: %p, length: %d\n", (void*)arg1, arg2,
-                    mem_info->ptr, mem_info->size);
-        fbt_suicide_str("Application tried to mmap internal BT data! "  \
-                        "(fbt_syscall.c)\n");
-      }
-      mem_info = mem_info->next;
+    struct mem_info *mem_info = fbt_find_bt_memory(tld, startptr, size);
+    if (mem_info != NULL) {
+      PRINT_DEBUG("Application got access to internal data and tries to " \
+                  "mmap  our memory. Access rejected. Address: %p, length: " \
+                  "%d\nMem_info: %p, length: %d\n", (void*)arg1, arg2,
+                  mem_info->ptr, mem_info->size);
+      fbt_suicide_str("Application tried to mmap internal BT data! "  \
+                      "(fbt_syscall.c)\n");
     }
   }
   return SYSCALL_AUTH_GRANTED;
@@ -761,30 +801,58 @@ auth_mmap2(struct thread_local_data *tld __attribute__((unused)),
   // TODO(philix): extract the common code from auth_mmap and auth_mmap2;
 
   /* ensure we don't remap memory structures of the BT */
-  struct mem_info *mem_info = tld->chunk;
   void *startptr = (void*)arg1;
   ulong_t size = arg2;
   if (startptr != NULL) {
-    while (mem_info != NULL) {
-      if (OVERLAPPING_REGIONS(startptr, size, mem_info->ptr, mem_info->size)) {
-        PRINT_DEBUG("Application got access to internal data and tries to " \
-                    "mmap  our memory. Access rejected. Address: %p, length: " \
-                    "%d\nMem_info: %p, length: %d\n", (void*)arg1, arg2,
-                    mem_info->ptr, mem_info->size);
-        fbt_suicide_str("Application tried to mmap internal BT data! "  \
-                        "(fbt_syscall.c)\n");
-      }
-      mem_info = mem_info->next;
+    struct mem_info *mem_info = fbt_find_bt_memory(tld, startptr, size);
+    if (mem_info != NULL) {
+      PRINT_DEBUG("Application got access to internal data and tries to " \
+                  "mmap  our memory. Access rejected. Address: %p, length: " \
+                  "%d\nMem_info: %p, length: %d\n", (void*)arg1, arg2,
+                  mem_info->ptr, mem_info->size);
+      fbt_suicide_str("Application tried to mmap internal BT data! "  \
+                      "(fbt_syscall.c)\n");
     }
   }
   return SYSCALL_AUTH_GRANTED;
 }
 #endif  // SYS_mmap2
 
+static enum syscall_auth_response
+auth_munmap(struct thread_local_data *tld, ulong_t syscall_nr,
+            ulong_t arg1, ulong_t arg2,
+            ulong_t arg3 __attribute__((unused)),
+            ulong_t arg4 __attribute__((unused)),
+            ulong_t arg5 __attribute__((unused)),
+            ulong_t *arg6 __attribute__((unused)),
+            ulong_t is_sysenter __attribute__((unused)),
+            ulong_t *retval __attribute__((unused))) {
+  if (syscall_nr != SYS_munmap) {
+    fbt_suicide_str("Invalid system call number in munmap (fbt_syscall.c).");
+  }
+
+  /* ensure we don't unmap memory structures of the BT */
+  void *startptr = (void*)arg1;
+  ulong_t size = arg2;
+  if (fbt_find_bt_memory(tld, startptr, size) != NULL) {
+    PRINT_DEBUG("Application got access to internal data and tries to munmap" \
+                " our memory. Access rejected. Address: %p, length: %d\n",
+                (void*)arg1, arg2);
+    fbt_suicide_str("Application tried to unmap internal BT data! "   \
+                    "(fbt_syscall.c)\n");
+  }
+
+  /* a library might be mapped to the same place later on */
+  fbt_lock_code_cache(tld);
+  fbt_ccache_invalidate(tld, startptr, size);
+  fbt_unlock_code_cache(tld);
+
+  return SYSCALL_AUTH_GRANTED;
+}
+
 static enum syscall_auth_response
 auth_mprotect(struct thread_local_data *tld, ulong_t syscall_nr,
-              ulong_t arg1, ulong_t arg2,
-              ulong_t arg3 __attribute__((unused)),
+              ulong_t arg1, ulong_t arg2, ulong_t arg3,
               ulong_t arg4 __attribute__((unused)),
               ulong_t arg5 __attribute__((unused)),
               ulong_t *arg6 __attribute__((unused)),
@@ -795,23 +863,25 @@ auth_mprotect(struct thread_local_data *tld, ulong_t syscall_nr,
   }
 
   /* ensure we don't make memory structures of BT executable */
-  struct mem_info *mem_info = tld->chunk;
-
   void *startptr = (void*)arg1;
   ulong_t size = arg2;
-  while (mem_info != NULL) {
-    if (OVERLAPPING_REGIONS(startptr, size, mem_info->ptr, mem_info->size)) {
-      PRINT_DEBUG("Application got access to internal data and tries to mprotect" \
-                  " our memory. Access rejected. Address: %p, length: %d\n",
-                  (void*)arg1, arg2);
-      fbt_suicide_str("Application tried to remap internal BT data! "   \
-                      "(fbt_syscall.c)\n");
-    }
-    mem_info = mem_info->next;
+  if (fbt_find_bt_memory(tld, startptr, size) != NULL) {
+    PRINT_DEBUG("Application got access to internal data and tries to mprotect" \
+                " our memory. Access rejected. Address: %p, length: %d\n",
+                (void*)arg1, arg2);
+    fbt_suicide_str("Application tried to remap internal BT data! "   \
+                    "(fbt_syscall.c)\n");
   }
 
   /* TODO: add check for regions of elf files */
 
+  /* the code in the region can be modified or must not be executed anymore */
+  if ((arg3 & PROT_WRITE) || !(arg3 & PROT_EXEC)) {
+    fbt_lock_code_cache(tld);
+    fbt_ccache_invalidate(tld, startptr, size);
+    fbt_unlock_code_cache(tld);
+  }
+
 #if defined(SECU_ALLOW_RUNTIME_ALLOC)
   /* TODO: secu allow runtime code alloc */
     if (arg3 & PROT_EXEC) {
@@ -856,6 +926,7 @@ void fbt_init_syscalls(struct thread_local_data *tld) {
 #ifdef SYS_mmap2
   tld->syscall_table[SYS_mmap2] = &auth_mmap2;
 #endif
+  tld->syscall_table[SYS_munmap] = &auth_munmap;
   tld->syscall_table[SYS_mprotect] = &auth_mprotect;
 
 #if defined(HANDLE_SIGNALS)
@@ -866,29 +937,21 @@ void fbt_init_syscalls(struct thread_local_data *tld) {
 #endif
   tld->syscall_table[SYS_sigaction] = &auth_signal;
   tld->syscall_table[SYS_rt_sigaction] = &auth_signal;
-  init_signal_handlers(tld);
 #endif  /* HANDLE_SIGNALS */
 #if defined(HANDLE_THREADS)
   tld->syscall_table[SYS_clone] = &auth_clone;
   tld->syscall_table[SYS_exit] = &auth_exit;
   tld->syscall_table[SYS_exit_group] = &auth_exit;
 #endif  /* HANDLE_THREADS */
+
+  fbt_init_syscalls_thread(tld);
 }
 
-/**
- * overwrite dlclose so that libraries can never be unmapped.
- * If a library gets unmapped and a new library gets mapped to the same place then
- * we might execute stale code that is still in the code cache.
- *
- * TODO: An other option to forbidding the dlclose is to flush the code cache
- * and the hashtable.
- * TODO: handle dlsym, dlvsym, dl_iterate_phdr as well
- **/
-__attribute__((visibility("default"))) int dlclose(void *handle __attribute__((unused))) {
-  #if defined(DEBUG)
-  llprintf("fbt_syscall.c: dlclose intercepted (handle: 0x%p)!\n", handle);
-  #endif
-  return 0;
+void fbt_init_syscalls_thread(struct thread_local_data *tld
+                              __attribute__((unused))) {
+#if defined(HANDLE_SIGNALS)
+  init_signal_handlers(tld);
+#endif  /* HANDLE_SIGNALS */
 }
 
 #endif  /* AUTHORIZE_SYSCALLS */
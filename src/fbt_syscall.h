@@ -42,6 +42,14 @@ struct thread_local_data;
  * @param tld pointer to thread local data.
  */
 void fbt_init_syscalls(struct thread_local_data *tld);
+
+/**
+ * Initialize the thread local part of the system call authorization (the
+ * signal handlers). fbt_init_syscalls calls this, threads that share the
+ * system call table of their parent (SHARED_CODE_CACHE) only call this.
+ * @param tld pointer to thread local data.
+ */
+void fbt_init_syscalls_thread(struct thread_local_data *tld);
 #endif  /* AUTHORIZE_SYSCALLS */
 
 #if defined(HANDLE_SIGNALS)
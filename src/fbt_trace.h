@@ -0,0 +1,133 @@
+/**
+ * @file fbt_trace.h
+ * Hot traces: loop heads count their executions and once a head gets hot the
+ * path that is executed next is recorded into a single-entry, multiple-exit
+ * trace in a separate region of the code cache.
+ *
+ * Copyright (c) 2011 ETH Zurich
+ * @author Mathias Payer <mathias.payer@nebelwelt.net>
+ *
+ * $Date: 2011-12-30 14:24:05 +0100 (Fri, 30 Dec 2011) $
+ * $LastChangedDate: 2011-12-30 14:24:05 +0100 (Fri, 30 Dec 2011) $
+ * $LastChangedBy: payerm $
+ * $Revision: 1134 $
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301, USA.
+ */
+#ifndef FBT_TRACE_H
+#define FBT_TRACE_H
+
+#include "fbt_datatypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(HOT_TRACES)
+
+/** number of executions of a loop head until we record a trace */
+#if !defined(TRACE_THRESHOLD)
+# define TRACE_THRESHOLD 50
+#endif
+/** maximum number of blocks in a trace */
+#if !defined(TRACE_MAX_BLOCKS)
+# define TRACE_MAX_BLOCKS 16
+#endif
+
+/** size of the trace cache (traces and counter stubs) in pages */
+#define TRACE_CACHE_PAGES 0x100
+/** pages at the end of the trace cache that hold the counter stubs */
+#define TRACE_STUB_PAGES 0x40
+/** maximum length of a counter stub */
+#define TRACE_STUB_SIZE 64
+/** pages for the execution counters (one per counter stub) */
+#define TRACE_COUNTER_PAGES \
+  ((TRACE_STUB_PAGES * sizeof(ulong_t) + TRACE_STUB_SIZE - 1) / TRACE_STUB_SIZE)
+
+/* forward declare structs */
+struct thread_local_data;
+struct trampoline;
+
+/**
+ * The trace cache of a thread. Traces are never freed, if the trace cache is
+ * full then no new traces and counters are added.
+ */
+struct trace_cache {
+  /** start of the trace cache */
+  Code *base;
+  /** next free byte for traces */
+  Code *code;
+  /** end of the space for traces (first counter stub) */
+  Code *code_end;
+  /** next free byte for counter stubs */
+  Code *stubs;
+  /** next free execution counter */
+  ulong_t *counters;
+  /** end of the execution counters */
+  ulong_t *counters_end;
+  /** %ecx is saved here while a counter stub runs */
+  ulong_t scratch;
+
+  /** trampoline of the counter stub that started the trace that is currently
+      recorded (or NULL if no trace is recorded) */
+  struct trampoline *head_trampo;
+  /** first block of the recorded trace */
+  void *head;
+  /** last block of the recorded trace */
+  void *last_block;
+  /** number of blocks in the recorded trace */
+  long nr_blocks;
+  /** end of the recorded trace (the trace starts at code) */
+  Code *end;
+  /** guest code of the blocks of the recorded trace so far */
+  Code *orig_start;
+  Code *orig_end;
+};
+
+/**
+ * Called whenever a direct jump in the code cache is linked to the translated
+ * code of a loop head (i.e., a backward jump). Emits a counter stub that counts
+ * the executions of the jump and starts the recording of a trace once the
+ * counter reaches TRACE_THRESHOLD.
+ * @param tld pointer to thread local data
+ * @param head address of the loop head in the original program
+ * @param transl_head translated code of the loop head
+ * @return the address the jump should be linked to (the counter stub, or
+ * transl_head if there is no space left or transl_head is a trace already)
+ */
+void *fbt_trace_head(struct thread_local_data *tld, void *head,
+                     void *transl_head);
+
+/**
+ * Called for every trampoline before the target of the trampoline is
+ * translated. Starts the recording of a trace if the trampoline belongs to a
+ * counter stub and extends the recorded trace if the trampoline is the last
+ * exit of the trace. Any other trampoline finishes the recorded trace.
+ * @param tld pointer to thread local data
+ * @param trampo the trampoline that was executed
+ * @return the code that is executed next, or NULL if the trampoline is
+ * handled as usual
+ */
+void *fbt_trace_trampoline(struct thread_local_data *tld,
+                           struct trampoline *trampo);
+
+#endif  /* HOT_TRACES */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* FBT_TRACE_H */
@@ -45,6 +45,25 @@ struct thread_local_data;
  */
 void fbt_initialize_trampolines(struct thread_local_data *tld);
 
+#if defined(SHARED_CODE_CACHE)
+/**
+ * Lets the tld of a new thread use the shared trampolines of its parent and
+ * generates the thread private bootstrap trampoline.
+ * @param tld pointer to thread local data of the new thread
+ * @param parent pointer to thread local data of the parent thread
+ */
+void fbt_inherit_trampolines(struct thread_local_data *tld,
+                             struct thread_local_data *parent);
+#endif  /* SHARED_CODE_CACHE */
+
+/**
+ * Generates new lookup trampolines for the current mapping table (they have
+ * the address of the table and the hash pattern baked in) and redirects the
+ * existing lookup trampolines to them.
+ * @param tld pointer to thread local data
+ */
+void fbt_update_lookup_trampolines(struct thread_local_data *tld);
+
 #ifdef __cplusplus
 }
 #endif
@@ -53,6 +53,12 @@
 
 #if defined(INLINE_CALLS)
 #define INLINE_MAX_LENGTH 64
+#if defined(TIERED_TRANSLATION)
+/* only the optimizing tier pays for the analysis of the callee */
+#define INLINE_IN_TIER(ts) ((ts)->tier != 0)
+#else
+#define INLINE_IN_TIER(ts) 1
+#endif  /* TIERED_TRANSLATION */
 #endif
 
 #if defined(INLINE_CALLS)
@@ -74,6 +80,104 @@ static ulong_t check_inline(struct translate *ts);
 static void check_transl_allowed(void* orig_address, struct mem_info *info);
 #endif
 
+/**
+ * Makes sure that there is space for another TU in the code cache. If the
+ * current code cache is full then a new one is allocated and the old one jumps
+ * to the new one.
+ * @param tld pointer to thread local data
+ */
+static void reserve_code_cache(struct thread_local_data *tld) {
+  struct translate *ts = &(tld->trans);
+  /* check if more memory needs to be allocated for tcache */
+  if ((long)(ts->code_cache_end - ts->transl_instr) < MAX_BLOCK_SIZE) {
+    PRINT_DEBUG("Not enough memory for new code block - allocating more!");
+    Code *prev_transl_instr = ts->transl_instr;
+
+    fbt_allocate_new_code_cache(tld);
+
+    /* add a jmp connect old and new tcache memory blocks */
+    if (prev_transl_instr != NULL) {
+#if defined(CCACHE_EVICTION)
+      fbt_ccache_add_link(tld, prev_transl_instr + 1, ORIGIN_RELATIVE);
+#endif  /* CCACHE_EVICTION */
+      JUMP_TO(prev_transl_instr, ts->transl_instr);
+    }
+  }
+}
+
+#if defined(TIERED_TRANSLATION)
+/**
+ * Emits the prologue of a fragment of the first tier. The prologue counts the
+ * executions of the fragment (without changing the flags) and jumps to a
+ * trampoline once the fragment is hot. The first jump of the prologue is
+ * redirected to the code of the optimizing tier afterwards, so that all jumps
+ * that are linked to the fragment reach the new code.
+ * @param tld pointer to thread local data
+ * @param orig_address start of the fragment in the original program
+ */
+static void emit_tier_counter(struct thread_local_data *tld,
+                              void *orig_address) {
+  if (tld->tier_counters == tld->tier_counters_end) {
+    tld->tier_counters = fbt_lalloc(tld, 1, MT_INTERNAL);
+    tld->tier_counters_end = tld->tier_counters + PAGESIZE / sizeof(ulong_t);
+  }
+  ulong_t *counter = tld->tier_counters++;
+  *counter = TIER_THRESHOLD;
+
+  Code *entry = tld->trans.transl_instr;
+  Code *code = entry;
+  struct trampoline *trampo = fbt_create_trampoline(tld, orig_address,
+                                                    entry + 1, ORIGIN_TIER);
+  JUMP_TO(code, entry + 5);
+  BEGIN_ASM(code)
+    movl %ecx, {&(tld->tier_scratch)}
+    movl {counter}, %ecx
+    leal -1(%ecx), %ecx
+    movl %ecx, {counter}
+    jecxz hot
+    movl {&(tld->tier_scratch)}, %ecx
+    jmp body
+  hot:
+    movl {&(tld->tier_scratch)}, %ecx
+    jmp_abs {trampo->code}
+  body:
+  END_ASM
+  tld->trans.transl_instr = code;
+}
+
+void *fbt_translate_tier1(struct thread_local_data *tld,
+                          struct trampoline *trampo) {
+  PRINT_DEBUG_FUNCTION_START("translate_tier1(*tld=%p, *orig_address=%p)",
+                             tld, trampo->target);
+  struct translate *ts = &(tld->trans);
+  Code *entry = trampo->origin;
+  void *transl_address = fbt_ccache_find(tld, trampo->target);
+
+  if (transl_address == entry - 1) {
+    reserve_code_cache(tld);
+    transl_address = ts->transl_instr;
+    /* jumps back to the start of the fragment link to the new code */
+    fbt_ccache_add_entry(tld, trampo->target, transl_address);
+    ts->orig_start = ts->orig_end = trampo->target;
+    ts->tier = 1;
+    fbt_translate_unit(tld, trampo->target);
+    ts->tier = 0;
+    fbt_ccache_close_fragment(tld, transl_address, ts->transl_instr,
+                              ts->orig_start, ts->orig_end);
+  } else if (transl_address == NULL) {
+    /* the fragment was invalidated in the meantime */
+    transl_address = fbt_translate_noexecute(tld, trampo->target);
+  }
+
+  /* the old fragment forwards to the new code */
+  *((int32_t*)entry) = (int32_t)((ulong_t)transl_address - (ulong_t)entry - 4);
+  fbt_trampoline_free(tld, trampo);
+
+  PRINT_DEBUG_FUNCTION_END("-> %p", transl_address);
+  return transl_address;
+}
+#endif  /* TIERED_TRANSLATION */
+
 void *fbt_translate_noexecute(struct thread_local_data *tld,
                               void *orig_address) {
   PRINT_DEBUG_FUNCTION_START("translate_noexecute(*tld=%p, *orig_address=%p)",
@@ -88,18 +192,344 @@ void *fbt_translate_noexecute(struct thread_local_data *tld,
     return already_translated;
   }
 
-  struct mem_info *code_block = tld->chunk;
   /* make sure that we don't translate translated code */
-  while (code_block != NULL) {
-    if ((orig_address >= code_block->ptr) &&
-        (orig_address < (code_block->ptr + code_block->size))) {
-      llprintf("Translating translated code: %p (%p len: 0x%x (%p) type: %d (syscall=%d))\n",
-               orig_address, code_block->ptr, code_block->size, code_block,
-               code_block->type, MT_SYSCALL_TABLE);
-      fbt_suicide(255);
+  struct mem_info *code_block = fbt_find_bt_memory(tld, orig_address, 1);
+  if (code_block != NULL) {
+    llprintf("Translating translated code: %p (%p len: 0x%x (%p) type: %d (syscall=%d))\n",
+             orig_address, code_block->ptr, code_block->size, code_block,
+             code_block->type, MT_SYSCALL_TABLE);
+    fbt_suicide(255);
+  }
+
+  /* we need to translate TU, add to ccache index,
+     jump to the translated code */
+  struct translate *ts = &(tld->trans);
+
+  reserve_code_cache(tld);
+  PRINT_DEBUG("tld->ts.transl_instr: %p", ts->transl_instr);
+
+  /* add entry to ccache index */
+#if defined(SHARED_CODE_CACHE)
+  /* other threads must not find the TU before it is complete */
+  ts->tu_orig_address = orig_address;
+  ts->tu_transl_address = ts->transl_instr;
+  tld->shared_data->nr_translations++;
+#else
+  fbt_ccache_add_entry(tld, orig_address, ts->transl_instr);
+#endif  /* SHARED_CODE_CACHE */
+
+  /* look up address in translation cache index */
+  void *transl_address = ts->transl_instr;
+
+#if defined(TIERED_TRANSLATION)
+  emit_tier_counter(tld, orig_address);
+#endif  /* TIERED_TRANSLATION */
+
+  ts->orig_start = ts->orig_end = orig_address;
+  long bytes_translated __attribute__((unused)) =
+    fbt_translate_unit(tld, orig_address);
+
+#if defined(SHARED_CODE_CACHE)
+  /* the TU is complete, publish it in the shared mapping table */
+  ts->tu_orig_address = NULL;
+  fbt_ccache_add_entry(tld, orig_address, transl_address);
+#endif  /* SHARED_CODE_CACHE */
+  fbt_ccache_close_fragment(tld, transl_address, ts->transl_instr,
+                            ts->orig_start, ts->orig_end);
+#if defined(EAGER_BACKPATCHING)
+  fbt_link_pending_trampolines(tld, orig_address, transl_address);
+#endif  /* EAGER_BACKPATCHING */
+
+  PRINT_DEBUG_FUNCTION_END("-> %p,   next_tu=%p (len: %d)", transl_address,
+                           ts->next_instr, bytes_translated);
+
+  return transl_address;
+}
+
+#if defined(BATCH_TRANSLATION)
+/** maximum length of an instruction (in bytes) */
+#define MAX_INSTR_LENGTH 15
+
+/**
+ * Checks if a range of the original program can be read during a speculative
+ * translation. The readable pages around the range are remembered for the
+ * rest of the translation.
+ * @param ts translate struct
+ * @param addr start of the range
+ * @param len length of the range in bytes
+ * @return 1 if the range is readable, 0 otherwise
+ */
+static long spec_readable(struct translate *ts, Code *addr, ulong_t len) {
+  if (addr >= ts->spec_readable_start && addr + len <= ts->spec_readable_end) {
+    return 1;
+  }
+#if defined(SECU_ENFORCE_NX)
+  if (!fbt_memprotect_execquery(addr)) {
+    return 0;
+  }
+#endif  /* SECU_ENFORCE_NX */
+  Code *start = (Code*)((ulong_t)addr & ~(PAGESIZE - 1));
+  Code *end = (Code*)(((ulong_t)addr + len + PAGESIZE - 1) & ~(PAGESIZE - 1));
+  if (!fbt_mem_readable(start, end - start)) {
+    return 0;
+  }
+  ts->spec_readable_start = start;
+  ts->spec_readable_end = end;
+  return 1;
+}
+
+/**
+ * Checks if the decoded instruction can be translated during a speculative
+ * translation, i.e., its action neither ends the program (unhandled opcodes,
+ * illegal interrupts and prefixes, see the fbt_suicide calls of the actions)
+ * nor reads memory that might not be mapped.
+ * @param ts translate struct of the decoded instruction
+ * @return 1 if the instruction can be translated, 0 otherwise
+ */
+static long speculation_allowed(struct translate *ts) {
+  actionFunP_t handler = ts->cur_instr_info->opcode.handler;
+  Code *op = ts->cur_instr + ts->num_prefixes;
+  /* the actions look at the bytes that follow the instruction (e.g., PLT stubs
+     and pop after call) */
+  if (!spec_readable(ts, ts->cur_instr, 2 * MAX_INSTR_LENGTH)) {
+    return 0;
+  }
+  if (handler == action_fail) {
+    return 0;
+  }
+  if ((handler == action_copy || handler == action_warn) &&
+      *(ts->cur_instr) == 0xcd && *(ts->first_byte_after_opcode) != 0x80) {
+    return 0;
+  }
+  if ((handler == action_jmp || handler == action_jmp_indirect ||
+       handler == action_jcc || handler == action_call) &&
+      ts->num_prefixes != 0) {
+    return 0;
+  }
+  if (handler == action_ret && *op == 0xc2 &&
+      *(int16_t*)(ts->first_byte_after_opcode) < 0) {
+    return 0;
+  }
+  if (handler == action_call && *op == 0xe8) {
+    /* action_call looks for get_pc thunks at the callee */
+    Code *callee = ts->next_instr + *(int32_t*)(op + 1);
+    return spec_readable(ts, callee, 4);
+  }
+  return 1;
+}
+#endif  /* BATCH_TRANSLATION */
+
+#if defined(TRANSLATION_IR)
+/**
+ * Checks if a lea instruction only adds 0 to its destination register, e.g.,
+ * lea 0x0(%esi,%eiz,1),%esi (used by compilers as padding).
+ * @param op pointer to the opcode of the lea
+ * @return 1 if the lea is a nop, 0 otherwise
+ */
+static long ir_nop_lea(Code *op) {
+  unsigned char mod = op[1] >> 6;
+  unsigned char reg = (op[1] >> 3) & 0x7;
+  unsigned char base = op[1] & 0x7;
+  Code *disp = op + 2;
+  if (mod == 3) {
+    return 0;
+  }
+  if (base == 4) {
+    /* SIB byte, there must not be an index register */
+    if (((op[2] >> 3) & 0x7) != 4) {
+      return 0;
+    }
+    base = op[2] & 0x7;
+    disp++;
+  }
+  if ((mod == 0 && base == 5) || base != reg) {
+    return 0;
+  }
+  if (mod == 1) {
+    return *(signed char*)disp == 0;
+  }
+  if (mod == 2) {
+    return *(int32_t*)disp == 0;
+  }
+  return 1;
+}
+
+/**
+ * Peephole pass: removes instructions without effect. These are nop (also
+ * with operand size prefixes), the multi-byte nop (0f 1f), mov between the
+ * same register and lea that adds 0 to a register.
+ */
+static void ir_pass_peephole(struct ir_instr *ir, long len) {
+  long i, j;
+  for (i = 0; i < len; ++i) {
+    Code *op = ir[i].cur_instr + ir[i].num_prefixes;
+    /* only operand size prefixes (f3 90 is pause) */
+    for (j = 0; j < ir[i].num_prefixes; ++j) {
+      if (ir[i].cur_instr[j] != PREFIX_OP_SZ_OVR) {
+        break;
+      }
+    }
+    if (j != ir[i].num_prefixes) {
+      continue;
+    }
+    if (op[0] == 0x90 || (op[0] == 0x0f && op[1] == 0x1f) ||
+        ((op[0] == 0x89 || op[0] == 0x8b) && (op[1] >> 6) == 3 &&
+         ((op[1] >> 3) & 0x7) == (op[1] & 0x7)) ||
+        (op[0] == 0x8d && ir[i].num_prefixes == 0 && ir_nop_lea(op))) {
+      ir[i].flags |= IR_DELETED;
     }
-    code_block = code_block->next;
   }
+}
+
+/**
+ * Checks if an instruction has no effect except on the status flags, i.e., it
+ * is a compare or test between registers and immediates.
+ */
+static long ir_writes_flags_only(struct ir_instr *instr) {
+  Code *op = instr->cur_instr;
+  unsigned char reg = (op[1] >> 3) & 0x7;
+  if (instr->num_prefixes != 0) {
+    return 0;
+  }
+  switch (op[0]) {
+  case 0x3c: case 0x3d: case 0xa8: case 0xa9:
+    return 1;
+  case 0x38: case 0x39: case 0x3a: case 0x3b: case 0x84: case 0x85:
+    break;
+  case 0x80: case 0x81: case 0x83:
+    if (reg != 7) {
+      return 0;
+    }
+    break;
+  case 0xf6: case 0xf7:
+    if (reg != 0) {
+      return 0;
+    }
+    break;
+  default:
+    return 0;
+  }
+  /* no memory operand (a load could fault) */
+  return (op[1] >> 6) == 3;
+}
+
+/**
+ * Liveness pass for the status flags. The analysis runs backwards over the
+ * decoded instructions and removes compares and tests whose flags are
+ * overwritten before they are read. The flags are live at the end of the run
+ * (the next instruction is a branch or a special instruction).
+ */
+static void ir_pass_flag_liveness(struct ir_instr *ir, long len) {
+  unsigned char live = EFLAGS_STATUS;
+  long i;
+  for (i = len - 1; i >= 0; --i) {
+    const ArchOpcode *info = ir[i].cur_instr_info;
+    if (ir[i].flags & IR_DELETED) {
+      continue;
+    }
+    if ((info->eflagsWritten & live) == 0 && ir_writes_flags_only(&ir[i])) {
+      ir[i].flags |= IR_DELETED;
+      continue;
+    }
+    live = (live & ~info->eflagsWritten) | (info->eflagsRead & EFLAGS_STATUS);
+  }
+}
+
+/** the optimization passes, in the order they run over the decoded code */
+static void (*const ir_passes[])(struct ir_instr*, long) = {
+  ir_pass_peephole,
+  ir_pass_flag_liveness,
+};
+
+/**
+ * Decodes the straight line code at ts->next_instr into ts->ir and runs the
+ * optimization passes over it. The run ends at the first instruction that is
+ * not copied verbatim (this one is decoded again by the caller) or after an
+ * interrupt (action_copy closes the TU there, the code after it is not
+ * necessarily mapped or valid).
+ * @param ts translate struct
+ * @param end no instruction at or after end is decoded
+ * @return number of decoded instructions
+ */
+static long ir_decode_run(struct translate *ts, Code *end) {
+  struct translate dis;
+  long len = 0;
+  unsigned long i;
+  dis.next_instr = ts->next_instr;
+#if defined(BATCH_TRANSLATION)
+  dis.speculative = ts->speculative;
+  if (ts->speculative && end > ts->spec_readable_end - MAX_INSTR_LENGTH) {
+    /* only decode what is known to be readable */
+    end = ts->spec_readable_end - MAX_INSTR_LENGTH;
+  }
+#endif  /* BATCH_TRANSLATION */
+  while (len < TRANSLATION_IR_SIZE && dis.next_instr < end) {
+    fbt_disasm_instr(&dis);
+    if (dis.cur_instr_info->opcode.handler != action_copy) {
+      break;
+    }
+    struct ir_instr *instr = &ts->ir[len++];
+    instr->cur_instr = dis.cur_instr;
+    instr->next_instr = dis.next_instr;
+    instr->cur_instr_info = dis.cur_instr_info;
+    instr->first_byte_after_opcode = dis.first_byte_after_opcode;
+    instr->num_prefixes = dis.num_prefixes;
+    instr->dest_operand_size = dis.dest_operand_size;
+    instr->src_operand_size = dis.src_operand_size;
+    instr->aux_operand_size = dis.aux_operand_size;
+    instr->flags = 0;
+    if (*(dis.cur_instr) == 0xcc || *(dis.cur_instr) == 0xcd ||
+        *(dis.cur_instr) == 0xce) {
+      break;
+    }
+  }
+  for (i = 0; i < sizeof(ir_passes) / sizeof(ir_passes[0]); ++i) {
+    ir_passes[i](ts->ir, len);
+  }
+  return len;
+}
+
+/**
+ * Loads the next instruction that was not removed by the passes into the
+ * translate struct (as fbt_disasm_instr would do). A new run is decoded if
+ * the current one is used up.
+ * @param ts translate struct
+ * @param pos index of the next instruction in ts->ir
+ * @param len number of instructions in ts->ir
+ * @param end no instruction at or after end is decoded
+ * @return 1 if an instruction was loaded, 0 if the next instruction must be
+ * decoded by fbt_disasm_instr
+ */
+static long ir_load_next(struct translate *ts, long *pos, long *len,
+                         Code *end) {
+  for (;;) {
+    if (*pos == *len) {
+      *len = ir_decode_run(ts, end);
+      *pos = 0;
+      if (*len == 0) {
+        return 0;
+      }
+    }
+    struct ir_instr *instr = &ts->ir[(*pos)++];
+    ts->next_instr = instr->next_instr;
+    if (!(instr->flags & IR_DELETED)) {
+      ts->cur_instr = instr->cur_instr;
+      ts->cur_instr_info = instr->cur_instr_info;
+      ts->first_byte_after_opcode = instr->first_byte_after_opcode;
+      ts->num_prefixes = instr->num_prefixes;
+      ts->dest_operand_size = instr->dest_operand_size;
+      ts->src_operand_size = instr->src_operand_size;
+      ts->aux_operand_size = instr->aux_operand_size;
+      return 1;
+    }
+    PRINT_DEBUG("removed a '%s' at %p", instr->cur_instr_info->mnemonic,
+                instr->cur_instr);
+  }
+}
+#endif  /* TRANSLATION_IR */
+
+long fbt_translate_unit(struct thread_local_data *tld, void *orig_address) {
+  struct translate *ts = &(tld->trans);
 
 #if defined(SECU_ENFORCE_NX)
   /* Check if the memory address to translate lies in an executable
@@ -109,33 +539,17 @@ void *fbt_translate_noexecute(struct thread_local_data *tld,
   check_transl_allowed(orig_address, &curr_section);
 #endif
 
-  /* we need to translate TU, add to ccache index,
-     jump to the translated code */
   enum translation_state tu_state = NEUTRAL;
 
-  int bytes_translated = 0;
-  struct translate *ts = &(tld->trans);
+  long bytes_translated = 0;
   ts->next_instr = (Code*)orig_address;
-
-  /* check if more memory needs to be allocated for tcache */
-  if ((long)(ts->code_cache_end - ts->transl_instr) < MAX_BLOCK_SIZE) {
-    PRINT_DEBUG("Not enough memory for new code block - allocating more!");
-    Code *prev_transl_instr = ts->transl_instr;
-
-    fbt_allocate_new_code_cache(tld);
-
-    /* add a jmp connect old and new tcache memory blocks */
-    if (prev_transl_instr != NULL) {
-      JUMP_TO(prev_transl_instr, ts->transl_instr);
-    }
-  }
-  PRINT_DEBUG("tld->ts.transl_instr: %p", ts->transl_instr);
-
-  /* add entry to ccache index */
-  fbt_ccache_add_entry(tld, orig_address, ts->transl_instr);
-
-  /* look up address in translation cache index */
-  void *transl_address = ts->transl_instr;
+#if defined(JUMP_TABLES)
+  ts->prev_instr = NULL;
+#endif  /* JUMP_TABLES */
+#if defined(TRANSLATION_IR)
+  /* position in and length of the decoded run in ts->ir */
+  long ir_pos = 0, ir_len = 0;
+#endif  /* TRANSLATION_IR */
 
   /* we translate as long as we
      - stay in the limit (MAX_BLOCK_SIZE)
@@ -154,6 +568,15 @@ void *fbt_translate_noexecute(struct thread_local_data *tld,
          (tu_state == OPEN)) {
 #endif  /* INLINE_CALLS */
     /* translate an instruction */
+#if defined(BATCH_TRANSLATION)
+    /* a speculative translation leaves code that it cannot read to the regular
+       translation (fbt_translate_speculative checks the first instruction) */
+    if (ts->speculative &&
+        !spec_readable(ts, ts->next_instr, 2 * MAX_INSTR_LENGTH)) {
+      tu_state = CLOSE_GLUE;
+      break;
+    }
+#endif  /* BATCH_TRANSLATION */
     /* Check if we are still within the boundaries of the current section.
        Otherwise, do a complete check of the address to translate and
        update the current section information. */
@@ -175,9 +598,39 @@ void *fbt_translate_noexecute(struct thread_local_data *tld,
     }
 #endif
 
+#if defined(TRANSLATION_IR)
+    /* decode ahead at most up to the end of the TU (and of the section) */
+    Code *ir_end = ts->next_instr + (MAX_BLOCK_SIZE - bytes_translated);
+#if defined(SECU_ENFORCE_NX)
+    if ((void*)ir_end > curr_section.node.addr_end) {
+      ir_end = (Code*)curr_section.node.addr_end;
+    }
+#endif  /* SECU_ENFORCE_NX */
+    if (!ir_load_next(ts, &ir_pos, &ir_len, ir_end)) {
+      fbt_disasm_instr(ts);
+    }
+#else
     fbt_disasm_instr(ts);
+#endif  /* TRANSLATION_IR */
+#if defined(BATCH_TRANSLATION)
+    if (ts->speculative && !speculation_allowed(ts)) {
+      /* the instruction is translated once it is reached */
+      ts->next_instr = ts->cur_instr;
+      tu_state = CLOSE_GLUE;
+      break;
+    }
+#endif  /* BATCH_TRANSLATION */
     PRINT_DEBUG("translating a '%s'", ts->cur_instr_info->mnemonic);
 
+    /* remember the guest code of the fragment (see fbt_ccache_invalidate) */
+    fbt_ccache_mark_guest(tld, ts->cur_instr, ts->next_instr);
+    if (ts->cur_instr < ts->orig_start) {
+      ts->orig_start = ts->cur_instr;
+    }
+    if (ts->next_instr > ts->orig_end) {
+      ts->orig_end = ts->next_instr;
+    }
+
     Code *old_transl_instr = ts->transl_instr;
 #ifdef DEBUG
     Code *old_cur_instr = ts->cur_instr;
@@ -190,7 +643,12 @@ void *fbt_translate_noexecute(struct thread_local_data *tld,
 
 #if defined(INLINE_CALLS)
     /* if the current instruction is a call, then we check if it is inlinable */
-    if (ts->cur_instr_info->opcode.handler == action_call) {
+    if (ts->cur_instr_info->opcode.handler == action_call &&
+#if defined(BATCH_TRANSLATION)
+        /* check_inline reads ahead at the callee */
+        !ts->speculative &&
+#endif  /* BATCH_TRANSLATION */
+        INLINE_IN_TIER(ts)) {
       unsigned int function_length;
       // inlinable ?
       if ((function_length = check_inline(ts)) &&
@@ -203,6 +661,9 @@ void *fbt_translate_noexecute(struct thread_local_data *tld,
 
     /* call the action specified for this instruction */
     tu_state = ts->cur_instr_info->opcode.handler(ts);
+#if defined(JUMP_TABLES)
+    ts->prev_instr = ts->cur_instr;
+#endif  /* JUMP_TABLES */
 
     bytes_translated += (ts->transl_instr - old_transl_instr);
 
@@ -244,10 +705,7 @@ void *fbt_translate_noexecute(struct thread_local_data *tld,
   assert((void*)(ts->transl_instr) < (void*)(ts->code_cache_end +
                                              TRANSL_GUARD));
 
-  PRINT_DEBUG_FUNCTION_END("-> %p,   next_tu=%p (len: %d)", transl_address,
-                           ts->next_instr, bytes_translated);
-
-  return transl_address;
+  return bytes_translated;
 }
 
 #if defined(SECU_ENFORCE_NX)
@@ -290,6 +748,12 @@ static ulong_t check_inline(struct translate *ts) {
 #endif
   myts.next_instr = (Code *)(*((int32_t*)(myts.cur_instr + 1)) +
                              (int32_t)myts.cur_instr + 5);
+#if defined(__i386__)
+  /* action_call replaces calls of get_pc thunks with a load */
+  if (fbt_get_pc_thunk_reg(myts.next_instr) != -1) {
+    return 0;
+  }
+#endif
 
   while (function_length < INLINE_MAX_LENGTH) {
     fbt_disasm_instr(&myts);
@@ -316,3 +780,85 @@ static ulong_t check_inline(struct translate *ts) {
   return 0;
 }
 #endif
+
+#if defined(FLAG_LIVENESS)
+long fbt_flags_dead(void *orig_address) {
+  struct translate ts;
+  unsigned char written = 0;
+  long i;
+  ts.next_instr = (Code*)orig_address;
+#if defined(BATCH_TRANSLATION)
+  ts.speculative = 0;
+#endif  /* BATCH_TRANSLATION */
+  for (i = 0; i < FLAG_LIVENESS_LOOKAHEAD; ++i) {
+    fbt_disasm_instr(&ts);
+    /* a flag that is read before it is overwritten is live */
+    if ((ts.cur_instr_info->eflagsRead & EFLAGS_STATUS & ~written) != 0) {
+      return 0;
+    }
+    /* we do not follow branches (and do not look into instructions that are
+       handled by special actions) */
+    if (ts.cur_instr_info->opcode.handler != action_copy) {
+      return 0;
+    }
+    written |= ts.cur_instr_info->eflagsWritten;
+    if ((written & EFLAGS_STATUS) == EFLAGS_STATUS) {
+      return 1;
+    }
+  }
+  return 0;
+}
+#endif  /* FLAG_LIVENESS */
+
+#if defined(BATCH_TRANSLATION)
+void fbt_queue_speculative(struct thread_local_data *tld, void *target) {
+  struct translate *ts = &(tld->trans);
+  ts->spec_queue[ts->spec_top++ & (BATCH_QUEUE_SIZE - 1)] = target;
+  if (ts->spec_count < BATCH_QUEUE_SIZE) {
+    ts->spec_count++;
+  }
+}
+
+/**
+ * Checks if the first instruction at a queued target can be translated
+ * speculatively. A TU that stops in front of its first instruction would jump
+ * to a trampoline for its own start and thus loop forever.
+ * @param ts translate struct
+ * @param target IP in the untranslated code
+ * @return 1 if the target can be translated speculatively, 0 otherwise
+ */
+static long speculation_start_allowed(struct translate *ts, void *target) {
+  struct translate first;
+  if (!spec_readable(ts, (Code*)target, 2 * MAX_INSTR_LENGTH)) {
+    return 0;
+  }
+  fbt_memcpy(&first, ts, sizeof(struct translate));
+  first.next_instr = (Code*)target;
+  fbt_disasm_instr(&first);
+  return speculation_allowed(&first);
+}
+
+void fbt_translate_speculative(struct thread_local_data *tld) {
+  struct translate *ts = &(tld->trans);
+  long nr_translated = 0;
+  while (nr_translated < BATCH_SIZE && ts->spec_count != 0) {
+    ts->spec_count--;
+    void *target = ts->spec_queue[--ts->spec_top & (BATCH_QUEUE_SIZE - 1)];
+    /* the target may have been translated since it was queued (then its jumps
+       are linked already) */
+    if (!fbt_has_pending_trampolines(tld, target)) {
+      continue;
+    }
+    /* the mappings may have changed since the last translation */
+    ts->spec_readable_start = NULL;
+    ts->spec_readable_end = NULL;
+    ts->speculative = 1;
+    if (speculation_start_allowed(ts, target)) {
+      PRINT_DEBUG("speculative translation of %p", target);
+      fbt_translate_noexecute(tld, target);
+      nr_translated++;
+    }
+    ts->speculative = 0;
+  }
+}
+#endif  /* BATCH_TRANSLATION */
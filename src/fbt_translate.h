@@ -38,6 +38,11 @@ struct thread_local_data;
 /** Maximum size for a translated code block  */
 #define MAX_BLOCK_SIZE 512
 
+#if defined(TRANSLATION_IR)
+/** Maximum number of instructions that are decoded ahead in a TU */
+#define TRANSLATION_IR_SIZE 128
+#endif  /* TRANSLATION_IR */
+
 /** the translation can be in these states. */
 enum translation_state {
   /** translation must not stop after this instruction but must continue */
@@ -68,6 +73,37 @@ typedef enum translation_state (*actionFunP_t)(struct translate *ts);
 void *fbt_translate_noexecute(struct thread_local_data *tld,
                               void *orig_address);
 
+#if defined(TIERED_TRANSLATION)
+/** number of executions of a fragment of the first tier until it is translated
+    again by the optimizing tier */
+#if !defined(TIER_THRESHOLD)
+# define TIER_THRESHOLD 500
+#endif
+
+/**
+ * Translates a hot fragment again with all optimizations (the second tier).
+ * The new fragment replaces the old one in the mapping table and the old
+ * fragment jumps to the new one, so that all jumps that are linked to the old
+ * fragment reach the new code.
+ * @param tld pointer to thread local data.
+ * @param trampo the ORIGIN_TIER trampoline of the old fragment
+ * @return pointer to the new fragment
+ */
+void *fbt_translate_tier1(struct thread_local_data *tld,
+                          struct trampoline *trampo);
+#endif  /* TIERED_TRANSLATION */
+
+/**
+ * Translates the TU that begins at orig_address to tld->trans.transl_instr.
+ * If the TU does not end with a control flow transfer then a jump to a
+ * trampoline for the next instruction is added. The caller makes sure that
+ * there is enough space and updates the mapping table.
+ * @param tld pointer to thread local data.
+ * @param orig_address the address where the TU begins
+ * @return number of bytes of translated code (without the glue code)
+ */
+long fbt_translate_unit(struct thread_local_data *tld, void *orig_address);
+
 /**
  * Disassembles one instruction and fills in all information into the
  * struct translate.
@@ -80,4 +116,47 @@ void *fbt_translate_noexecute(struct thread_local_data *tld,
  */
 void fbt_disasm_instr(struct translate *ts);
 
+#if defined(FLAG_LIVENESS)
+/** number of instructions that the flag liveness analysis looks ahead */
+#define FLAG_LIVENESS_LOOKAHEAD 16
+
+/**
+ * Checks if the status flags (CF, PF, AF, ZF, SF and OF) are dead at an
+ * address in the original program, i.e., all of them are overwritten before
+ * they are read. The analysis follows the straight line code and gives up at
+ * the first instruction that is not copied verbatim (e.g., a branch).
+ * @param orig_address address in the original program
+ * @return 1 if the flags are dead at orig_address, 0 otherwise
+ */
+long fbt_flags_dead(void *orig_address);
+#endif  /* FLAG_LIVENESS */
+
+#if defined(BATCH_TRANSLATION)
+/** number of targets that the queue for speculative translation holds (the
+    oldest targets are dropped if it overflows) */
+#define BATCH_QUEUE_SIZE 1024
+/** maximum number of TUs that are translated ahead per trampoline miss */
+#define BATCH_SIZE 8
+
+/**
+ * Queues the target of a new trampoline for speculative translation.
+ * @param tld thread local data
+ * @param target IP in the untranslated code
+ */
+void fbt_queue_speculative(struct thread_local_data *tld, void *target);
+
+/**
+ * Translates up to BATCH_SIZE of the most recently queued targets that
+ * are still waited for by jumps in the code cache. The jumps are linked to the
+ * new TUs (see fbt_link_pending_trampolines), so they do not leave the code
+ * cache when they are taken. A speculative TU ends in front of code that is not
+ * readable or whose translation would end the program (unhandled opcodes,
+ * illegal interrupts); that code is translated once it is reached.
+ * Called from translate_execute while the translator runs anyway (on the
+ * application thread, there is no helper thread).
+ * @param tld thread local data
+ */
+void fbt_translate_speculative(struct thread_local_data *tld);
+#endif  /* BATCH_TRANSLATION */
+
 #endif /* FBT_TRANSLATE_H */
@@ -38,6 +38,7 @@
 #define fbt_gettid(res) _syscall(gettid, (res))
 #define fbt_fstat64(fd, stat, res) _syscall2(fstat64, (fd), (stat), (res))
 #define fbt_stat64(path, stat, res) _syscall2(stat64, (path), (stat), (res))
+#define fbt_lstat64(path, stat, res) _syscall2(lstat64, (path), (stat), (res))
 #define fbt_fstat(fd, stat, res) _syscall2(fstat, (fd), (stat), (res))
 
 #ifdef SYS_mmap
@@ -57,6 +58,11 @@
 #endif
 
 #define fbt_munmap(addr, length, res) _syscall2(munmap, (addr), (length), (res))
+#if defined(SYS_process_vm_readv) && defined(__i386__)
+# define fbt_process_vm_readv(pid, lvec, liovcnt, rvec, riovcnt, flags, res) \
+   _syscall6_regs(process_vm_readv, (pid), (lvec), (liovcnt), (rvec),   \
+                  (riovcnt), (flags), (res))
+#endif  /* SYS_process_vm_readv && __i386__ */
 #define fbt_mprotect(addr, len, prot, res) \
   _syscall3(mprotect, (addr), (len), (prot), (res))
 
@@ -75,6 +81,11 @@
   _syscall3(readlink, (src), (dest), (len), (res))
 #define fbt_set_thread_area(uinfo, res) \
   _syscall1(set_thread_area, (uinfo), (res))
+#define fbt_rename(oldpath, newpath, res) \
+  _syscall2(rename, (oldpath), (newpath), (res))
+#define fbt_unlink(path, res) _syscall1(unlink, (path), (res))
+#define fbt_mkdir(path, mode, res) _syscall2(mkdir, (path), (mode), (res))
+#define fbt_geteuid(res) _syscall(geteuid32, (res))
 
 #ifdef __i386__
 
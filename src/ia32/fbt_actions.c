@@ -32,10 +32,208 @@
 #include "../fbt_debug.h"
 #include "../fbt_code_cache.h"
 #include "../fbt_mem_mgmt.h"
+#include "../fbt_trace.h"
 #include "../fbt_translate.h"
 #include "fbt_x86_opcode.h"
 #include "fbt_asm_macros.h"
 
+/**
+ * Looks up the translated code that a direct jump or a jcc is linked to.
+ * @param ts translate struct of the current instruction
+ * @param target target of the jump in the original program
+ * @return the address the jump is linked to or NULL if the jump must go through
+ * a trampoline
+ */
+static void *find_link_target(struct translate *ts, void *target) {
+#if defined(HOT_TRACES)
+  /* the blocks of a trace leave through trampolines only, they are extended
+     with the targets that are actually executed (see fbt_trace.c) */
+  if (ts->in_trace) {
+    return NULL;
+  }
+#endif  /* HOT_TRACES */
+  void *transl_target = fbt_ccache_find(ts->tld, target);
+#if defined(HOT_TRACES)
+  /* a backward jump closes a loop, count the executions of the loop head */
+  if (transl_target != NULL && target <= (void*)ts->cur_instr) {
+    transl_target = fbt_trace_head(ts->tld, target, transl_target);
+  }
+#endif  /* HOT_TRACES */
+  return transl_target;
+}
+
+#if defined(ICF_PREDICT)
+/**
+ * Emits the prediction for an indirect control flow transfer: a chain of
+ * ICF_PREDICT_WAYS compares of the target (that is on the stack) against the
+ * cached targets. The entries are unused (0) at first and are filled in by the
+ * fixup routine when a target misses (see icf_predict_fixup). The chain is
+ * followed by the stub that replaces it if the transfer turns megamorphic.
+ * @param ts translate struct of the current instruction
+ * @param transl_addr current position in the code cache
+ * @param fixup fixup trampoline that handles a miss
+ * @param lookup lookup trampoline of the megamorphic stub (preserves the flags)
+ * @return position in the code cache after the prediction
+ */
+static unsigned char *emit_icf_prediction(struct translate *ts,
+                                          unsigned char *transl_addr,
+                                          void *fixup, void *lookup) {
+  if (ts->tld->icf_predict == NULL)
+    fbt_allocate_new_icf_predictors(ts->tld);
+  struct icf_prediction *pred = ts->tld->icf_predict;
+  ts->tld->icf_predict = pred->pred.next;
+
+  pred->pred.src = transl_addr;
+  pred->nrhits = 0;
+  pred->nrmispredict = 0;
+  pred->state = ICF_PREDICTING;
+  pred->period = 0;
+  pred->nrrearms = 0;
+
+  BEGIN_ASM(transl_addr)
+    pushfl
+  END_ASM
+
+  long i;
+  for (i = 0; i < ICF_PREDICT_WAYS; ++i) {
+    BEGIN_ASM(transl_addr)
+      cmpl $l0x0, 4(%esp)
+    END_ASM
+
+    pred->origin[i] = (ulong_t*)(transl_addr - 4);
+    pred->hits[i] = 0;
+
+#if defined(FLAG_LIVENESS)
+    JNE_I8(transl_addr, 0x0);
+    unsigned char *nohit = transl_addr - 1;
+
+    /* the flags are saved, we can count the hit. The restore is skipped by the
+       fixup routine if the flags are dead at the target (see
+       icf_predict_rewrite) */
+    BEGIN_ASM(transl_addr)
+      incl {&(pred->hits[i])}
+    END_ASM
+    pred->restore[i] = transl_addr;
+    BEGIN_ASM(transl_addr)
+      ASM_RESTORE_FLAGS
+    END_ASM
+    pred->restore_code[0] = pred->restore[i][0];
+    pred->restore_code[1] = pred->restore[i][1];
+    pred->restore_len = transl_addr - pred->restore[i];
+
+    BEGIN_ASM(transl_addr)
+      leal 8(%esp), %esp
+      jmp_abs {fixup}
+    END_ASM
+    *nohit = (char)(transl_addr - (nohit + 1));
+#else
+    /* the flags are saved, we can count the hit */
+    BEGIN_ASM(transl_addr)
+      jne nohit
+      incl {&(pred->hits[i])}
+      popfl
+      leal 4(%esp), %esp
+      jmp_abs {fixup}
+    nohit:
+    END_ASM
+#endif  /* FLAG_LIVENESS */
+
+    pred->dst[i] = (ulong_t*)(transl_addr - 4);
+  }
+
+  /* NO HIT, we need to fix the prediction */
+  BEGIN_ASM(transl_addr)
+    movl ${pred}, TLD_STACK(ts->tld, 11)
+    jmp_abs {fixup}
+  END_ASM
+
+  /* megamorphic stub: fast lookup, every period-th target goes to the fixup
+     routine as a sample */
+  pred->megamorphic = transl_addr;
+  BEGIN_ASM(transl_addr)
+    pushfl
+    decl {&(pred->countdown)}
+    jz sample
+    popfl
+    jmp_abs {lookup}
+  sample:
+    movl ${pred}, TLD_STACK(ts->tld, 11)
+    jmp_abs {fixup}
+  END_ASM
+
+  return transl_addr;
+}
+#endif  /* ICF_PREDICT */
+
+#if defined(TARGET_REG_LOOKUP)
+/**
+ * Selects the lookup trampoline of an indirect jump or call. If the target is
+ * a register (ModR/M with mod 11) then the variant of the trampoline for this
+ * register is used. It probes the mapping table with the register and does
+ * not have to save it. The choice does not depend on which registers are
+ * live, the variants always save %ebx.
+ * @param ts translate struct of the indirect jump or call
+ * @param variants variants of the lookup trampoline, indexed by register
+ * @param lookup the regular lookup trampoline
+ * @return lookup trampoline for the indirect jump or call
+ */
+static void *reg_lookup_trampoline(struct translate *ts, void **variants,
+                                   void *lookup) {
+  unsigned char modrm = *(ts->first_byte_after_opcode);
+  if ((ts->cur_instr_info->destFlags & OP_ADDRM_MASK) == ADDRM_E &&
+      (modrm & 0xC0) == 0xC0 && variants[modrm & 0x7] != NULL) {
+    return variants[modrm & 0x7];
+  }
+  return lookup;
+}
+#endif  /* TARGET_REG_LOOKUP */
+
+#if defined(SHADOW_STACK)
+/**
+ * Emits the push of a return address and its translation onto the shadow
+ * stack. If the return address is not translated yet then the entry points to
+ * a trampoline that translates it. The emitted code only uses %ecx (which is
+ * restored) and does not change the flags.
+ * @param ts translate struct of the current call
+ * @param transl_addr current position in the code cache
+ * @param return_addr return address of the call in the original program
+ * @return position in the code cache after the push
+ */
+static unsigned char *emit_shadow_push(struct translate *ts,
+                                       unsigned char *transl_addr,
+                                       void *return_addr) {
+  struct thread_local_data *tld = ts->tld;
+  void *transl_ret = fbt_ccache_find(tld, return_addr);
+
+  BEGIN_ASM(transl_addr)
+    movl %ecx, TLD_FIELD(tld, shadow_scratch[0])
+    movzbl TLD_FIELD(tld, shadow_top), %ecx
+    leal 1(%ecx), %ecx
+    movzbl %cl, %ecx
+    movb %cl, TLD_FIELD(tld, shadow_top)
+    movl ${return_addr}, TLD_FIELD(tld, shadow_stack[0].ret)(,%ecx,8)
+    movl ${transl_ret}, TLD_FIELD(tld, shadow_stack[0].transl)(,%ecx,8)
+  END_ASM
+
+  Code *origin = transl_addr - sizeof(void*);
+  if (transl_ret == NULL) {
+    /* the return address is translated when the callee returns */
+    struct trampoline *trampo = fbt_create_trampoline(tld, return_addr, origin,
+                                                      ORIGIN_SHADOW);
+    *(ulong_t*)origin = (ulong_t)trampo->code;
+  } else {
+#if defined(CCACHE_EVICTION)
+    fbt_ccache_add_link(tld, origin, ORIGIN_SHADOW);
+#endif  /* CCACHE_EVICTION */
+  }
+
+  BEGIN_ASM(transl_addr)
+    movl TLD_FIELD(tld, shadow_scratch[0]), %ecx
+  END_ASM
+  return transl_addr;
+}
+#endif  /* SHADOW_STACK */
+
 enum translation_state action_none(struct translate *ts __attribute__((unused))) {
   PRINT_DEBUG_FUNCTION_START("action_none(*ts=%p)", ts);
   /* do nothing */
@@ -65,8 +263,12 @@ enum translation_state action_copy(struct translate *ts) {
       ts->transl_instr -= length;
       transl_addr = ts->transl_instr;
       /* store location of this syscall */
-      MOVL_IMM32_MEM32(transl_addr, 0x05, addr, &(ts->tld->syscall_location));
-      MOVL_IMM32_MEM32(transl_addr, 0x05, 0x00c0ff33, &(ts->tld->ind_target));
+      TLD_SEGMENT_PREFIX(transl_addr);
+      MOVL_IMM32_MEM32(transl_addr, 0x05, addr,
+                       TLD_FIELD_M32(ts->tld, syscall_location));
+      TLD_SEGMENT_PREFIX(transl_addr);
+      MOVL_IMM32_MEM32(transl_addr, 0x05, 0x00c0ff33,
+                       TLD_FIELD_M32(ts->tld, ind_target));
 
       /* pointer to after int80 */
       ulong_t *ptr = (ulong_t*)(transl_addr-sizeof(void*));
@@ -160,7 +362,20 @@ enum translation_state action_jmp(struct translate *ts) {
   PRINT_DEBUG("original jmp_target: %p", (void*)jump_target);
 
   /* check if the target is already translated; if it is not, do so now */
-  void *transl_target = fbt_ccache_find(ts->tld, (void*)jump_target);
+  void *transl_target = find_link_target(ts, (void*)jump_target);
+#if defined(HOT_TRACES)
+  if (ts->in_trace) {
+    /* the trace is extended with the target once the jump is executed */
+    struct trampoline *trampo =
+      fbt_create_trampoline(ts->tld, (void*)jump_target, transl_addr + 1,
+                            ORIGIN_RELATIVE);
+    JMP_REL32(transl_addr, (int32_t)(trampo->code));
+    PRINT_DEBUG_FUNCTION_END("-> close, transl_length=%i",
+                             transl_addr - ts->transl_instr);
+    ts->transl_instr = transl_addr;
+    return CLOSE;
+  }
+#endif  /* HOT_TRACES */
   if (transl_target == NULL) {
     /* we still have to translate the call target */
     PRINT_DEBUG_FUNCTION_END("-> open, transl_length=0");
@@ -178,6 +393,9 @@ enum translation_state action_jmp(struct translate *ts) {
   PRINT_DEBUG("translated jmp_target: %p", transl_target);
 
   /* write: jmp */
+#if defined(CCACHE_EVICTION)
+  fbt_ccache_add_link(ts->tld, transl_addr + 1, ORIGIN_RELATIVE);
+#endif  /* CCACHE_EVICTION */
   JMP_REL32(transl_addr, (int32_t)transl_target);
 
   PRINT_DEBUG_FUNCTION_END("-> close, transl_length=%i",
@@ -186,6 +404,83 @@ enum translation_state action_jmp(struct translate *ts) {
   return CLOSE;
 }
 
+#if defined(PLT_CHAINING)
+/**
+ * Emits the translation of the jump of a PLT stub (`jmp *GOT` or
+ * `jmp *GOT(%ebx)`, followed by `push $n; jmp PLT0`). The guard compares the
+ * GOT entry to the target that was seen last (without changing the flags) and
+ * jumps straight to its translation. Otherwise the target is pushed and the
+ * fixup trampoline links the guard to the new target (see plt_fixup). The
+ * guard starts out with an impossible target, the first execution fills it in.
+ * @param ts translate struct of the jump
+ * @param transl_addr current position in the code cache
+ * @return position in the code cache after the guard, or NULL if the jump is
+ * not part of a PLT stub
+ */
+static unsigned char *emit_plt_guard(struct translate *ts,
+                                     unsigned char *transl_addr) {
+  unsigned char *addr = ts->cur_instr;
+  unsigned char *next = ts->next_instr;
+  if (ts->next_instr - ts->cur_instr != 6 ||
+      (addr[1] != 0x25 && addr[1] != 0xA3) ||
+      next[0] != 0x68 || next[5] != 0xE9) {
+    return NULL;
+  }
+#if defined(TIERED_TRANSLATION)
+  if (ts->tier == 0) {
+    return NULL;
+  }
+#endif  /* TIERED_TRANSLATION */
+  struct thread_local_data *tld = ts->tld;
+  struct plt_guard *guard = fbt_smalloc(tld, sizeof(struct plt_guard));
+  guard->nrfixes = 0;
+
+  BEGIN_ASM(transl_addr)
+    movl %ecx, TLD_FIELD(tld, plt_scratch)
+  END_ASM
+  /* movl GOT, %ecx */
+  *transl_addr++ = 0x8B;
+  *transl_addr++ = (addr[1] & 0xC7) | 0x08;
+  *(uint32_t*)transl_addr = *(uint32_t*)(addr + 2);
+  transl_addr += 4;
+  /* leal -target(%ecx), %ecx */
+  *transl_addr++ = 0x8D;
+  *transl_addr++ = 0x89;
+  guard->expected = (ulong_t*)transl_addr;
+  *(guard->expected) = -1;
+  transl_addr += 4;
+  JECXZ_I8(transl_addr, 0x0);
+  unsigned char *hit_offset = transl_addr - 1;
+
+  BEGIN_ASM(transl_addr)
+    movl TLD_FIELD(tld, plt_scratch), %ecx
+  END_ASM
+  unsigned char *miss = transl_addr;
+  BEGIN_ASM(transl_addr)
+    movl ${guard}, TLD_STACK(tld, 12)
+  END_ASM
+  /* pushl GOT */
+  *transl_addr++ = 0xFF;
+  *transl_addr++ = (addr[1] & 0xC7) | 0x30;
+  *(uint32_t*)transl_addr = *(uint32_t*)(addr + 2);
+  transl_addr += 4;
+  BEGIN_ASM(transl_addr)
+    jmp_abs {tld->opt_plt_fixup}
+  END_ASM
+  guard->miss = transl_addr - 4;
+
+  *hit_offset = (unsigned char)(transl_addr - (hit_offset + 1));
+  BEGIN_ASM(transl_addr)
+    movl TLD_FIELD(tld, plt_scratch), %ecx
+    jmp_abs {miss}
+  END_ASM
+  guard->hit = transl_addr - 4;
+
+  PRINT_DEBUG("PLT stub at %p uses guard %p", addr, guard);
+  return transl_addr;
+}
+#endif  /* PLT_CHAINING */
+
 enum translation_state action_jmp_indirect(struct translate *ts) {
   unsigned char *addr = ts->cur_instr;
   unsigned char* transl_addr = ts->transl_instr;
@@ -205,6 +500,16 @@ enum translation_state action_jmp_indirect(struct translate *ts) {
                     "(fbt_actions.c)\n");
   }
 
+#if defined(PLT_CHAINING)
+  unsigned char *plt_end = emit_plt_guard(ts, transl_addr);
+  if (plt_end != NULL) {
+    PRINT_DEBUG_FUNCTION_END("-> close, transl_length=%i",
+                             plt_end - ts->transl_instr);
+    ts->transl_instr = plt_end;
+    return CLOSE;
+  }
+#endif  /* PLT_CHAINING */
+
   /* this is a fast version of the ind jmp - handoptimized assembler code
    * which does a fast lookup in the hashtable and dispatches if it hits
    * otherwise it recovers to an indirect jump
@@ -215,6 +520,12 @@ enum translation_state action_jmp_indirect(struct translate *ts) {
    * jmpl  tld->ind_jump_trampoline
    */
 
+  void *lookup = ts->tld->opt_ijump_trampoline;
+#if defined(TARGET_REG_LOOKUP)
+  lookup = reg_lookup_trampoline(ts, ts->tld->opt_ijump_reg_trampoline,
+                                 lookup);
+#endif  /* TARGET_REG_LOOKUP */
+
   /* write: push indirect target */
   *transl_addr++ = 0xFF;
 
@@ -232,38 +543,22 @@ enum translation_state action_jmp_indirect(struct translate *ts) {
   }
 
 #if !defined(ICF_PREDICT)
-  JMP_REL32(transl_addr, (int32_t)(ts->tld->opt_ijump_trampoline));
+  JMP_REL32(transl_addr, (int32_t)lookup);
 
 #else  /* ICF_PREDICT */
-  if (ts->tld->icf_predict == NULL)
-    fbt_allocate_new_icf_predictors(ts->tld);
-  struct icf_prediction *pred = ts->tld->icf_predict;
-  ts->tld->icf_predict = pred->pred.next;
-
-  pred->pred.src = transl_addr;
-
-  BEGIN_ASM(transl_addr)
-    pushfl
-    cmpl $l0x0, 4(%esp)
-  END_ASM
-
-  pred->origin1 = (ulong_t*)(transl_addr - 4);
-
-  BEGIN_ASM(transl_addr)
-    jne nohit
-    popfl
-    leal 4(%esp), %esp
-    jmp_abs {transl_addr-4}
-  nohit:
-    // NO HIT, we need to fix the prediction
-  END_ASM
-
-  pred->dst1 = (ulong_t*)(transl_addr - 4);
-
-  BEGIN_ASM(transl_addr)
-    movl ${pred}, {ts->tld->stack-11}
-    jmp_abs {ts->tld->opt_ijump_predict_fixup}
-  END_ASM
+#if defined(TIERED_TRANSLATION)
+  if (ts->tier == 0) {
+    /* the first tier uses the plain lookup, predictors are set up once the
+       fragment is hot */
+    JMP_REL32(transl_addr, (int32_t)lookup);
+    PRINT_DEBUG_FUNCTION_END("-> close, transl_length=%i",
+                             transl_addr - ts->transl_instr);
+    ts->transl_instr = transl_addr;
+    return CLOSE;
+  }
+#endif  /* TIERED_TRANSLATION */
+  transl_addr = emit_icf_prediction(ts, transl_addr,
+                                    ts->tld->opt_ijump_predict_fixup, lookup);
 
 #endif  /* ICF_PREDICT */
 
@@ -274,6 +569,89 @@ enum translation_state action_jmp_indirect(struct translate *ts) {
   return CLOSE;
 }
 
+#if defined(JUMP_TABLES)
+/**
+ * Recognizes the bounds check of a switch statement: the ja that is translated
+ * follows a `cmp $n, %reg` in the same TU and falls through to a
+ * `jmp *table(,%reg,4)` whose table lies in read-only memory. The table is
+ * translated into a table of the same size that holds the translated targets,
+ * the entries of untranslated targets are left empty (NULL) for the fill stub
+ * (see action_jcc).
+ * @param ts translate struct of the ja
+ * @param reg the index register (out)
+ * @return the translated jump table, or NULL if this is no switch statement
+ */
+static struct jump_table *translate_jump_table(struct translate *ts,
+                                               long *reg) {
+  unsigned char *addr = ts->cur_instr;
+  unsigned char *prev = ts->prev_instr;
+  if (prev == NULL || ts->num_prefixes != 0 ||
+      !(addr[0] == 0x77 || (addr[0] == 0x0F && addr[1] == 0x87))) {
+    return NULL;
+  }
+#if defined(HOT_TRACES)
+  /* traces leave through trampolines only */
+  if (ts->in_trace) {
+    return NULL;
+  }
+#endif  /* HOT_TRACES */
+#if defined(TIERED_TRANSLATION)
+  if (ts->tier == 0) {
+    return NULL;
+  }
+#endif  /* TIERED_TRANSLATION */
+
+  /* cmp $imm8, %reg / cmp $imm32, %reg / cmp $imm32, %eax */
+  long bound;
+  if (prev + 3 == addr && prev[0] == 0x83 && (prev[1] & 0xF8) == 0xF8) {
+    *reg = prev[1] & 0x7;
+    bound = *(signed char*)(prev + 2);
+  } else if (prev + 6 == addr && prev[0] == 0x81 && (prev[1] & 0xF8) == 0xF8) {
+    *reg = prev[1] & 0x7;
+    bound = *(int32_t*)(prev + 2);
+  } else if (prev + 5 == addr && prev[0] == 0x3D) {
+    *reg = 0;
+    bound = *(int32_t*)(prev + 1);
+  } else {
+    return NULL;
+  }
+  /* %esp can not be an index */
+  if (*reg == 4 || bound < 0 || bound >= JUMP_TABLE_MAX_ENTRIES) {
+    return NULL;
+  }
+
+  /* jmp *table(,%reg,4) */
+  unsigned char *jmp = ts->next_instr;
+  if (jmp[0] != 0xFF || jmp[1] != 0x24 || jmp[2] != (0x85 | (*reg << 3))) {
+    return NULL;
+  }
+  ulong_t *table = *(ulong_t**)(jmp + 3);
+  ulong_t nr_entries = bound + 1;
+  if (!fbt_mem_is_readonly(ts->tld, table, nr_entries * sizeof(ulong_t))) {
+    return NULL;
+  }
+
+  struct thread_local_data *tld = ts->tld;
+  if (tld->jump_table_entries + nr_entries > tld->jump_table_entries_end) {
+    fbt_allocate_new_jump_table_entries(tld);
+  }
+  struct jump_table *jt = fbt_smalloc(tld, sizeof(struct jump_table));
+  jt->table = table;
+  jt->nr_entries = nr_entries;
+  jt->transl = tld->jump_table_entries;
+  tld->jump_table_entries += nr_entries;
+
+  ulong_t i;
+  for (i = 0; i < nr_entries; ++i) {
+    jt->transl[i] = fbt_ccache_find(tld, (void*)table[i]);
+  }
+  jt->next = tld->jump_tables;
+  tld->jump_tables = jt;
+  PRINT_DEBUG("jump table %p with %d entries at %p", table, nr_entries, jmp);
+  return jt;
+}
+#endif  /* JUMP_TABLES */
+
 enum translation_state action_jcc(struct translate *ts) {
 
   unsigned char *addr = ts->cur_instr;
@@ -324,8 +702,11 @@ enum translation_state action_jcc(struct translate *ts) {
 
     /* write: jump to trampoline for fallthrough address */
     /* create trampoline if one is needed, otherwise lookup and go */
-    transl_target = fbt_ccache_find(ts->tld, (void*)virtual_fallthrough);
+    transl_target = find_link_target(ts, (void*)virtual_fallthrough);
     if ( transl_target != NULL ) {
+#if defined(CCACHE_EVICTION)
+      fbt_ccache_add_link(ts->tld, transl_addr + 1, ORIGIN_RELATIVE);
+#endif  /* CCACHE_EVICTION */
       BEGIN_ASM(transl_addr)
         jmp_abs {transl_target}
       END_ASM
@@ -366,8 +747,11 @@ enum translation_state action_jcc(struct translate *ts) {
 
     /* write: jump address to trampoline; create trampoline if one is needed,
        otherwise lookup and go */
-    transl_target = fbt_ccache_find(ts->tld, (void*)jump_target);
+    transl_target = find_link_target(ts, (void*)jump_target);
     if ( transl_target != NULL ) {
+#if defined(CCACHE_EVICTION)
+      fbt_ccache_add_link(ts->tld, transl_addr + 2, ORIGIN_RELATIVE);
+#endif  /* CCACHE_EVICTION */
       JCC_2B(transl_addr, jcc_type, (ulong_t)transl_target);
     } else {
       struct trampoline *trampo =
@@ -377,10 +761,76 @@ enum translation_state action_jcc(struct translate *ts) {
     }
   }
 
+#if defined(JUMP_TABLES)
+  long reg;
+  struct jump_table *jt = translate_jump_table(ts, &reg);
+  if (jt != NULL) {
+    /* the fall-through is the jump through the table, the index is in bounds
+       (the ja was not taken) and the flags are not changed */
+    unsigned char sib = 0x85 | (reg << 3);
+    /* jmp *transl(,%reg,4) */
+    *transl_addr++ = 0xFF;
+    *transl_addr++ = 0x24;
+    *transl_addr++ = sib;
+    *(void***)transl_addr = jt->transl;
+    transl_addr += 4;
+
+    /* pushl table(,%reg,4); jmp opt_ijump_trampoline */
+    jt->fallback = transl_addr;
+    *transl_addr++ = 0xFF;
+    *transl_addr++ = 0x34;
+    *transl_addr++ = sib;
+    *(ulong_t**)transl_addr = jt->table;
+    transl_addr += 4;
+    JMP_REL32(transl_addr, (int32_t)(ts->tld->opt_ijump_trampoline));
+
+    /* movl %reg, jump_table_index; jmp trampoline (the trampoline fills in
+       the entry, so untranslated targets cost no trampoline until they are
+       used) */
+    jt->fill = transl_addr;
+    struct trampoline *trampo =
+      fbt_create_trampoline(ts->tld, NULL, jt, ORIGIN_JUMP_TABLE);
+    TLD_SEGMENT_PREFIX(transl_addr);
+    *transl_addr++ = 0x89;
+    *transl_addr++ = 0x05 | (reg << 3);
+    *(uint32_t*)transl_addr =
+      (uint32_t)TLD_FIELD_M32(ts->tld, jump_table_index);
+    transl_addr += 4;
+    JMP_REL32(transl_addr, (int32_t)(trampo->code));
+    ulong_t i;
+    for (i = 0; i < jt->nr_entries; ++i) {
+      if (jt->transl[i] == NULL) {
+        jt->transl[i] = jt->fill;
+      }
+    }
+
+    PRINT_DEBUG_FUNCTION_END("-> close, transl_length=%i",
+                             transl_addr - ts->transl_instr);
+    ts->transl_instr = transl_addr;
+    return CLOSE;
+  }
+#endif  /* JUMP_TABLES */
+
   /* write: jump to trampoline for fallthrough address */
-  transl_target = fbt_ccache_find(ts->tld, (void*)fallthru_target);
+  transl_target = find_link_target(ts, (void*)fallthru_target);
   if ( transl_target != NULL ) {
+#if defined(CCACHE_EVICTION)
+    fbt_ccache_add_link(ts->tld, transl_addr + 1, ORIGIN_RELATIVE);
+#endif  /* CCACHE_EVICTION */
     JMP_REL32(transl_addr, (ulong_t)transl_target);
+#if defined(JCC_FALLTHROUGH)
+  } else if (fallthru_target == (ulong_t)ts->next_instr
+#if defined(HOT_TRACES)
+             && !ts->in_trace
+#endif  /* HOT_TRACES */
+             ) {
+    /* the fall-through is not translated yet, the TU continues with it (the
+       translation loop closes the TU if it grows too large) */
+    PRINT_DEBUG_FUNCTION_END("-> neutral, transl_length=%i",
+                             transl_addr - ts->transl_instr);
+    ts->transl_instr = transl_addr;
+    return NEUTRAL;
+#endif  /* JCC_FALLTHROUGH */
   } else {
     struct trampoline *trampo =
       fbt_create_trampoline(ts->tld, (void*)fallthru_target,
@@ -396,6 +846,15 @@ enum translation_state action_jcc(struct translate *ts) {
   return CLOSE;
 }
 
+long fbt_get_pc_thunk_reg(unsigned char *func) {
+  /* movl (%esp), %reg (8b /r with SIB 0x24); ret */
+  if (func[0] == 0x8B && (func[1] & 0xC7) == 0x04 && func[2] == 0x24 &&
+      func[3] == 0xC3 && MODRM_REG(func[1]) != 4) {
+    return MODRM_REG(func[1]);
+  }
+  return -1;
+}
+
 enum translation_state action_call(struct translate *ts) {
   unsigned char *addr = ts->cur_instr;
 
@@ -439,6 +898,18 @@ enum translation_state action_call(struct translate *ts) {
     return OPEN;
   }
 
+  /* the callee is a get_pc thunk of PIC code that loads the return address
+     into a register, we load it directly (the stack is the same after the
+     thunk returns) */
+  long thunk_reg = fbt_get_pc_thunk_reg((unsigned char*)call_target);
+  if (thunk_reg != -1) {
+    MOVL_IMM32_R32(transl_addr, thunk_reg, (uint32_t)return_addr);
+    PRINT_DEBUG_FUNCTION_END("-> neutral (get_pc thunk), transl_length=%i",
+                             transl_addr - ts->transl_instr);
+    ts->transl_instr = transl_addr;
+    return NEUTRAL;
+  }
+
   /* write: push original EIP (we have to do this either way) */
   // TODO: 64bit needs a 64bit push!
   int32_t return_address = (int32_t)return_addr;
@@ -465,6 +936,24 @@ enum translation_state action_call(struct translate *ts) {
   }
 #endif
 
+#if defined(SHADOW_STACK)
+  transl_addr = emit_shadow_push(ts, transl_addr, return_addr);
+#endif  /* SHADOW_STACK */
+
+#if defined(HOT_TRACES)
+  if (ts->in_trace) {
+    /* the trace is extended with the callee once the call is executed */
+    struct trampoline *trampo =
+      fbt_create_trampoline(ts->tld, (void*)call_target, transl_addr + 1,
+                            ORIGIN_RELATIVE);
+    JMP_REL32(transl_addr, (int32_t)(trampo->code));
+    PRINT_DEBUG_FUNCTION_END("-> close, transl_length=%i",
+                             transl_addr - ts->transl_instr);
+    ts->transl_instr = transl_addr;
+    return CLOSE;
+  }
+#endif  /* HOT_TRACES */
+
   /* check if target is already translated; if not, do so now */
   void *transl_target = fbt_ccache_find(ts->tld, (void*)call_target);
 
@@ -486,6 +975,9 @@ enum translation_state action_call(struct translate *ts) {
   PRINT_DEBUG("translated call_target: %p", transl_target);
 
   /* write: jump instruction to translated target */
+#if defined(CCACHE_EVICTION)
+  fbt_ccache_add_link(ts->tld, transl_addr + 1, ORIGIN_RELATIVE);
+#endif  /* CCACHE_EVICTION */
   BEGIN_ASM(transl_addr)
     jmp_abs {transl_target}
   END_ASM
@@ -520,6 +1012,11 @@ enum translation_state action_call_indirect(struct translate *ts) {
   PUSHL_IMM32(transl_addr, (ulong_t)return_addr);
   PRINT_DEBUG("original eip: %p", return_addr);
 
+#if defined(SHADOW_STACK)
+  /* %ecx is restored before the target is pushed */
+  transl_addr = emit_shadow_push(ts, transl_addr, return_addr);
+#endif  /* SHADOW_STACK */
+
   /*
    * check for prefixes:
    * we handle only segment override prefixes, all others produce an error
@@ -613,42 +1110,42 @@ enum translation_state action_call_indirect(struct translate *ts) {
     }
   }
 
+#if !defined(ICF_PREDICT) || defined(TIERED_TRANSLATION)
+  void *lookup = ts->tld->opt_icall_trampoline;
+#if defined(TARGET_REG_LOOKUP)
+  lookup = reg_lookup_trampoline(ts, ts->tld->opt_icall_reg_trampoline,
+                                 lookup);
+#endif  /* TARGET_REG_LOOKUP */
+#endif  /* !ICF_PREDICT || TIERED_TRANSLATION */
+
 #if !defined(ICF_PREDICT)
   /* write: jump instruction to trampoline */
   BEGIN_ASM(transl_addr)
-    jmp_abs {ts->tld->opt_icall_trampoline}
+    jmp_abs {lookup}
   END_ASM
 
 #else  /* ICF_PREDICT */
-  if (ts->tld->icf_predict == NULL)
-    fbt_allocate_new_icf_predictors(ts->tld);
-  struct icf_prediction *pred = ts->tld->icf_predict;
-  ts->tld->icf_predict = pred->pred.next;
-
-  pred->pred.src = transl_addr;
-
-  BEGIN_ASM(transl_addr)
-    pushfl
-    cmpl $l0x0, 4(%esp)
-  END_ASM
-
-  pred->origin1 = (ulong_t*)(transl_addr - 4);
-
-  BEGIN_ASM(transl_addr)
-    jne nohit
-    popfl
-    leal 4(%esp), %esp
-    jmp_abs {transl_addr+4}
-  nohit:
-    // NO HIT, we need to fix the prediction
-  END_ASM
-
-  pred->dst1 = (ulong_t*)(transl_addr - 4);
-
-  BEGIN_ASM(transl_addr)
-    movl ${pred}, {ts->tld->stack-11}
-    jmp_abs {ts->tld->opt_icall_predict_fixup}
-  END_ASM
+#if defined(TIERED_TRANSLATION)
+  if (ts->tier == 0) {
+    /* the first tier uses the plain lookup (see action_jmp_indirect) */
+    BEGIN_ASM(transl_addr)
+      jmp_abs {lookup}
+    END_ASM
+    ts->transl_instr = transl_addr;
+    PRINT_DEBUG_FUNCTION_END("-> close");
+    return CLOSE;
+  }
+#endif  /* TIERED_TRANSLATION */
+  /* the megamorphic stub uses the lookup of indirect jumps that preserves the
+     flags */
+  void *ijump_lookup = ts->tld->opt_ijump_trampoline;
+#if defined(TARGET_REG_LOOKUP)
+  ijump_lookup = reg_lookup_trampoline(ts, ts->tld->opt_ijump_reg_trampoline,
+                                       ijump_lookup);
+#endif  /* TARGET_REG_LOOKUP */
+  transl_addr = emit_icf_prediction(ts, transl_addr,
+                                    ts->tld->opt_icall_predict_fixup,
+                                    ijump_lookup);
 
 #endif  /* ICF_PREDICT */
 
@@ -667,8 +1164,9 @@ enum translation_state action_sysenter(struct translate *ts) {
 #endif
 #if defined(AUTHORIZE_SYSCALLS)
   /* store location of this syscall */
+  TLD_SEGMENT_PREFIX(transl_addr);
   MOVL_IMM32_MEM32(transl_addr, 0x05, ts->cur_instr,
-                   &(ts->tld->syscall_location));
+                   TLD_FIELD_M32(ts->tld, syscall_location));
 #endif
   /* write: jump instruction to trampoline */
   JMP_REL32(transl_addr, (ulong_t)(ts->tld->sysenter_trampoline));
@@ -751,14 +1249,114 @@ enum translation_state action_ret(struct translate *ts) {
    * back to the callee (no optimization)
    */
   int32_t jmp_target = 0;
+  int16_t rem_bytes = 0;
   if (*addr == 0xc2) {
     /* this ret wants to pop some bytes of the stack */
-    int16_t rem_bytes = *((int16_t*)first_byte_after_opcode);
+    rem_bytes = *((int16_t*)first_byte_after_opcode);
     PRINT_DEBUG("we must remove additional bytes: %d\n", rem_bytes);
     if (rem_bytes < 0) {
       fbt_suicide_str("Ret removes a negative amount of bytes, this is "
                       "illegal! (fbt_actions.c)\n");
     }
+  }
+
+#if defined(SHADOW_STACK)
+  /*
+   * If the return address matches the top of the shadow stack then we pop the
+   * entry and jump to its translation. %ecx = ~expected + 1 + actual is 0 on a
+   * match, so the flags are not changed on this path.
+   * Otherwise we search the SHADOW_STACK_SEARCH entries below the top. A match
+   * there means that frames were left without a return (longjmp, exceptions),
+   * their entries are popped as well. Like the trampoline the search does not
+   * preserve the flags. If there is no match (e.g., returns of signal handlers
+   * or code that changes its return address) we leave the shadow stack alone
+   * and use the trampoline.
+   */
+  BEGIN_ASM(transl_addr)
+    movl %ecx, TLD_FIELD(ts->tld, shadow_scratch[0])
+    movl %edx, TLD_FIELD(ts->tld, shadow_scratch[1])
+    movzbl TLD_FIELD(ts->tld, shadow_top), %edx
+    movl TLD_FIELD(ts->tld, shadow_stack[0].ret)(,%edx,8), %ecx
+    notl %ecx
+    movl (%esp), %edx
+    leal 1(%ecx,%edx), %ecx
+    jecxz shadow_hit
+
+    movl %eax, TLD_FIELD(ts->tld, shadow_scratch[2])
+    movl (%esp), %eax
+    movzbl TLD_FIELD(ts->tld, shadow_top), %edx
+    movl ${SHADOW_STACK_SEARCH}, %ecx
+  shadow_search:
+    leal -1(%edx), %edx
+    movzbl %dl, %edx
+    cmpl TLD_FIELD(ts->tld, shadow_stack[0].ret)(,%edx,8), %eax
+    je shadow_found
+    loop shadow_search
+    movl TLD_FIELD(ts->tld, shadow_scratch[2]), %eax
+    movl TLD_FIELD(ts->tld, shadow_scratch[1]), %edx
+    movl TLD_FIELD(ts->tld, shadow_scratch[0]), %ecx
+    jmp shadow_miss
+  shadow_found:
+    /* the entries above the match are stale */
+    movb %dl, TLD_FIELD(ts->tld, shadow_top)
+    movl TLD_FIELD(ts->tld, shadow_scratch[2]), %eax
+  shadow_hit:
+    movzbl TLD_FIELD(ts->tld, shadow_top), %edx
+    movl TLD_FIELD(ts->tld, shadow_stack[0].transl)(,%edx,8), %ecx
+    movl %ecx, TLD_FIELD(ts->tld, ind_target)
+    leal -1(%edx), %edx
+    movb %dl, TLD_FIELD(ts->tld, shadow_top)
+    movl TLD_FIELD(ts->tld, shadow_scratch[1]), %edx
+    movl TLD_FIELD(ts->tld, shadow_scratch[0]), %ecx
+    leal {4 + rem_bytes}(%esp), %esp
+    jmp *TLD_FIELD(ts->tld, ind_target)
+  shadow_miss:
+  END_ASM
+#endif  /* SHADOW_STACK */
+
+#if defined(RET_CACHE)
+  if (*addr == 0xc3) {
+    /*
+     * The low bits of the return address select an entry of the return cache
+     * of this ret. If the entry holds the return address then we jump to its
+     * translation, otherwise the fixup trampoline fills in the entry. Like
+     * opt_ret_trampoline this does not preserve the flags.
+     */
+    struct thread_local_data *tld = ts->tld;
+    if (tld->ret_caches == tld->ret_caches_end) {
+      fbt_allocate_new_ret_caches(tld);
+    }
+    struct ret_cache *cache = tld->ret_caches++;
+    BEGIN_ASM(transl_addr)
+      pushl %ecx
+      pushl %edx
+      movl 8(%esp), %ecx
+      movl %ecx, %edx
+      andl ${RET_CACHE_ENTRIES - 1}, %ecx
+      cmpl {&cache->entries[0].ret}(, %ecx, 8), %edx
+      jne ret_cache_miss
+      movl {&cache->entries[0].transl}(, %ecx, 8), %ecx
+      movl %ecx, TLD_FIELD(tld, ind_target)
+      popl %edx
+      popl %ecx
+      leal 4(%esp), %esp
+      jmp *TLD_FIELD(tld, ind_target)
+    ret_cache_miss:
+      popl %edx
+      popl %ecx
+      movl ${cache}, TLD_STACK(tld, 12)
+      jmp_abs {tld->opt_ret_cache_fixup}
+    END_ASM
+    cache->miss = transl_addr - sizeof(void*);
+
+    PRINT_DEBUG_FUNCTION_END("-> close, transl_length=%i",
+                             transl_addr - ts->transl_instr);
+    ts->transl_instr = transl_addr;
+    return CLOSE;
+  }
+#endif  /* RET_CACHE */
+
+  if (*addr == 0xc2) {
     PUSHL_IMM32(transl_addr, (int32_t)rem_bytes);
     jmp_target = (int32_t)(ts->tld->opt_ret_remove_trampoline);
   }
@@ -73,6 +73,9 @@
 #define MOVL_IMM32_EAX(dst, imm32) *dst++=0xb8; \
   *((uint32_t*)dst) = imm32; dst+=4;
 
+#define MOVL_IMM32_R32(dst, reg, imm32) *dst++=0xb8+(reg); \
+  *((uint32_t*)dst) = imm32; dst+=4;
+
 #define MOVL_IMM32_MEM32(dst, modrm, imm32, mem32) *dst++=0xc7; *dst++=modrm;  \
   CHECKMEM32PTR(mem32) *((uint32_t*)dst) = (uint32_t)((ulong_t)mem32); dst+=4; \
   CHECKMEM32PTR(imm32) *((uint32_t*)dst) = (uint32_t)((ulong_t)imm32); dst+=4
@@ -192,4 +195,53 @@
 
 #define XOR_R32_R32(dst, modrm) *dst++=0x31; *dst++=modrm
 
+#if defined(FLAG_LIVENESS)
+/* Restores the flags that were saved by a pushfl at 0(%esp) without a popfl,
+   for use inside of BEGIN_ASM blocks. The word at 4(%esp) is used as scratch
+   and both words stay on the stack. OF is set by an add that overflows iff OF
+   was set, the other status flags are loaded with sahf. DF must not have
+   changed since the pushfl. */
+#define ASM_RESTORE_FLAGS \
+    movl %eax, 4(%esp); \
+    movb 1(%esp), %al; \
+    andb $0x08, %al; \
+    addb $0x78, %al; \
+    movb (%esp), %ah; \
+    sahf; \
+    movl 4(%esp), %eax;
+#endif  /* FLAG_LIVENESS */
+
+/* Access to the thread local data from generated code.
+   Without SHARED_CODE_CACHE all generated code belongs to a single thread and
+   embeds the absolute addresses of its tld. With a shared code cache all
+   threads execute the same code and %fs points to the tld of the current
+   thread (the tld sits at the top of the secure stack, tld == tld->stack).
+   TLD_FIELD, TLD_STACK, PUSHL_TLD and MOVL_TLD_STACK_ESP are used inside of
+   BEGIN_ASM blocks, the *_M32 variants with the byte emitting macros above
+   (prefixed with TLD_SEGMENT_PREFIX). */
+#if defined(SHARED_CODE_CACHE)
+#include <stddef.h>  // for offsetof
+
+/* memory operand of a field in the tld */
+#define TLD_FIELD(tld, field) %fs:{offsetof(struct thread_local_data, field)}
+/* memory operand of the slot tld->stack-n on the secure stack */
+#define TLD_STACK(tld, n) %fs:{-(n)*(long)sizeof(ulong_t)}
+#define PUSHL_TLD(tld) pushl TLD_FIELD(tld, stack)
+#define MOVL_TLD_STACK_ESP(tld, n) movl TLD_FIELD(tld, stack), %esp; \
+  leal {-(n)*(long)sizeof(ulong_t)}(%esp), %esp
+
+#define TLD_SEGMENT_PREFIX(dst) *dst++=0x64
+#define TLD_FIELD_M32(tld, field) offsetof(struct thread_local_data, field)
+#define TLD_STACK_M32(tld, n) (-(n)*(long)sizeof(ulong_t))
+#else
+#define TLD_FIELD(tld, field) {&((tld)->field)}
+#define TLD_STACK(tld, n) {(tld)->stack-(n)}
+#define PUSHL_TLD(tld) pushl ${tld}
+#define MOVL_TLD_STACK_ESP(tld, n) movl ${(tld)->stack-(n)}, %esp
+
+#define TLD_SEGMENT_PREFIX(dst)
+#define TLD_FIELD_M32(tld, field) (&((tld)->field))
+#define TLD_STACK_M32(tld, n) ((tld)->stack-(n))
+#endif  /* SHARED_CODE_CACHE */
+
 #endif  /* FBT_ASM_MACROS_H */
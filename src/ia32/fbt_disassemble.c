@@ -46,6 +46,25 @@
  */
 static ulong_t fbt_operand_size(ulong_t operandFlags, unsigned char prefix);
 
+#if defined(BATCH_TRANSLATION)
+/** stands in for instructions that the disassembler cannot handle during a
+    speculative translation, fbt_translate_unit stops in front of them */
+static const struct ia32_opcode undecodable_opcode = {
+  .opcode = { .handler = action_fail },
+  .mnemonic = "(undecodable)"
+};
+
+/**
+ * Checks if fbt_operand_size gives up on an operand.
+ * @param operandFlags the operandFlags of the operand
+ * @return 1 if the operand is an unhandled immediate, 0 otherwise
+ */
+static long unhandled_operand(ulong_t operandFlags) {
+  return hasImmOp(operandFlags) && ((operandFlags & OPT_MASK) == OPT_p ||
+                                    (operandFlags & OPT_MASK) == OPT_si);
+}
+#endif  /* BATCH_TRANSLATION */
+
 
 void fbt_disasm_instr(struct translate *ts) {
   const struct ia32_opcode *opcode, *opcode_table = default_opcode_table;
@@ -95,6 +114,13 @@ void fbt_disasm_instr(struct translate *ts) {
          OVR prefix. more can be added. */
       if (!(ts->num_prefixes<=1 || ((prefix!=PREFIX_ADDR_SZ_OVR) &&
                                     (prefix!=PREFIX_OP_SZ_OVR)))) {
+#if defined(BATCH_TRANSLATION)
+        if (ts->speculative) {
+          ts->cur_instr_info = &undecodable_opcode;
+          ts->next_instr = ts->cur_instr + 1;
+          return;
+        }
+#endif  /* BATCH_TRANSLATION */
         /* we only support one prefix atm */
         fbt_suicide_str("Only one prefix supported (disasm_instr: "
                         "fbt_disassemble.c)\n");
@@ -197,6 +223,15 @@ void fbt_disasm_instr(struct translate *ts) {
         /* } */
       } else {
 #endif
+#if defined(BATCH_TRANSLATION)
+        if (ts->speculative && (unhandled_operand(opcode->destFlags) ||
+                                unhandled_operand(opcode->srcFlags) ||
+                                unhandled_operand(opcode->auxFlags))) {
+          ts->cur_instr_info = &undecodable_opcode;
+          ts->next_instr = ts->cur_instr + 1;
+          return;
+        }
+#endif  /* BATCH_TRANSLATION */
         /* read info regarding immediate arguments (imms, code offset, etc.) */
         if (hasImmOp(opcode->destFlags)) {
           ts->dest_operand_size = fbt_operand_size(opcode->destFlags, prefix);
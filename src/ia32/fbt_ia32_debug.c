@@ -92,7 +92,7 @@ void debug_dump_jmptable(char *orig_addr, char *transl_addr)
 
   pthread_mutex_lock(&dump_mutex);
   fllprintf(dumpJmpTableStream, "0x%x %p --> %p\n",
-            C_MAPPING_FUNCTION((long)orig_addr),
+            C_MAPPING_FUNCTION((long)orig_addr, MAPPINGTABLE_SIZE),
             (void*)orig_addr,
             (void*)transl_addr);
   /*fsync(dumpJmpTableStream);*/
@@ -169,6 +169,29 @@
                      "gi"((long)(arg1))                                  \
                      : "memory")
 
+/* system calls with six arguments in registers (_syscall6 passes a pointer to
+   the arguments like old_mmap expects), the sixth argument goes into %ebp */
+#define _syscall6_regs(name,arg1,arg2,arg3,arg4,arg5,arg6,__res)        \
+  do {                                                                  \
+    long __args[6] = { (long)(arg1), (long)(arg2), (long)(arg3),        \
+                       (long)(arg4), (long)(arg5), (long)(arg6) };      \
+    __asm__ volatile("pushl %%ebp ;"                                    \
+                     "pushl %%ebx ;"                                    \
+                     "movl 0(%%eax), %%ebx ;"                           \
+                     "movl 4(%%eax), %%ecx ;"                           \
+                     "movl 8(%%eax), %%edx ;"                           \
+                     "movl 12(%%eax), %%esi ;"                          \
+                     "movl 16(%%eax), %%edi ;"                          \
+                     "movl 20(%%eax), %%ebp ;"                          \
+                     "movl %2, %%eax ;"                                 \
+                     ENTER_KERNEL                                       \
+                     "popl %%ebx ;"                                     \
+                     "popl %%ebp"                                       \
+                     : "=a"(__res)                                      \
+                     : "0"(__args), "i"(SYS_##name)                     \
+                     : "ecx", "edx", "esi", "edi", "memory");           \
+  } while (0)
+
 #define SYSCALL_SUCCESS_OR_SUICIDE(__res, err) \
     if ((unsigned long)(__res) >= (unsigned long)(-(128 + 1))) {        \
       fbt_suicide(err);                                                 \
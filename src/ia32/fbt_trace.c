@@ -0,0 +1,341 @@
+/**
+ * @file fbt_trace.c
+ * Recording of hot traces for IA32.
+ *
+ * Backward jumps are linked to a counter stub instead of the loop head. The
+ * stub decrements a counter and jumps to the loop head. Once the counter reaches
+ * zero the stub jumps to a trampoline (ORIGIN_TRACE) and we start to record a
+ * trace: the loop head is translated into the trace cache and every block that
+ * is executed next is appended to the trace, until the path returns to the head,
+ * jumps backwards, or leaves the trace. The blocks of a trace only leave through
+ * trampolines. If the last exit of the trace is taken then the target is
+ * translated right behind it; if the taken exit is the branch of a jcc then the
+ * condition is inverted, so that the recorded path falls through. Finally the
+ * trace replaces the loop head in the mapping table and the counter stub jumps
+ * to the trace directly.
+ *
+ * Copyright (c) 2011 ETH Zurich
+ * @author Mathias Payer <mathias.payer@nebelwelt.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301, USA.
+ */
+
+#include <assert.h>
+#include <stdint.h>
+
+#include "../generic/fbt_libc.h"
+#include "../fbt_code_cache.h"
+#include "../fbt_datatypes.h"
+#include "../fbt_debug.h"
+#include "../fbt_mem_mgmt.h"
+#include "../fbt_trace.h"
+#include "../fbt_translate.h"
+#include "fbt_asm_macros.h"
+
+#if defined(HOT_TRACES)
+
+/**
+ * Allocates the trace cache and the counters of a thread.
+ * @param tld pointer to thread local data
+ * @return the trace cache
+ */
+static struct trace_cache *allocate_trace_cache(struct thread_local_data *tld) {
+  struct trace_cache *tc = fbt_smalloc(tld, sizeof(struct trace_cache));
+  fbt_memset(tc, 0, sizeof(struct trace_cache));
+
+  tc->base = fbt_lalloc(tld, TRACE_CACHE_PAGES, MT_TRACE_CACHE);
+  tc->code = tc->base;
+  tc->code_end = tc->base + (TRACE_CACHE_PAGES - TRACE_STUB_PAGES) * PAGESIZE;
+  tc->stubs = tc->code_end;
+
+  tc->counters = fbt_lalloc(tld, TRACE_COUNTER_PAGES, MT_INTERNAL);
+  tc->counters_end = tc->counters +
+    (TRACE_COUNTER_PAGES * PAGESIZE) / sizeof(ulong_t);
+
+  tld->traces = tc;
+  return tc;
+}
+
+/**
+ * Returns the trampoline of the jump at the end of the recorded trace.
+ * @param tld pointer to thread local data
+ * @param tc the trace cache
+ * @return the trampoline or NULL if the trace does not end with a jump to a
+ * trampoline (e.g., with a return or an indirect jump)
+ */
+static struct trampoline *tail_trampoline(struct thread_local_data *tld,
+                                          struct trace_cache *tc) {
+  Code *jmp = tc->end - 5;
+  if (jmp < tc->code || *jmp != 0xE9) {
+    return NULL;
+  }
+  struct trampoline *trampo =
+    (struct trampoline*)(tc->end + *((int32_t*)(jmp + 1)));
+  struct mem_info *chunk = fbt_find_bt_memory(tld, trampo,
+                                              sizeof(struct trampoline));
+  if (chunk == NULL || chunk->type != MT_TRAMPOLINE ||
+      trampo->origin != jmp + 1 || trampo->origin_t != ORIGIN_RELATIVE) {
+    return NULL;
+  }
+  return trampo;
+}
+
+/**
+ * Checks if a trampoline is reached through the last exit of the recorded
+ * trace, i.e., the jump at the end of the trace or the branch of the jcc right
+ * before that jump.
+ * @param tld pointer to thread local data
+ * @param tc the trace cache
+ * @param trampo the trampoline
+ * @return true if the trace can be extended with the target of the trampoline
+ */
+static int is_tail_exit(struct thread_local_data *tld, struct trace_cache *tc,
+                        struct trampoline *trampo) {
+  Code *origin = trampo->origin;
+  if (trampo->origin_t != ORIGIN_RELATIVE) {
+    return 0;
+  }
+  if (origin == tc->end - 4) {
+    return 1;
+  }
+  return origin == tc->end - 9 && origin - 2 >= tc->code &&
+    origin[-2] == 0x0F && (origin[-1] & 0xF0) == 0x80 &&
+    tail_trampoline(tld, tc) != NULL;
+}
+
+/**
+ * Publishes the recorded trace: the trace replaces the loop head in the mapping
+ * table and the counter stub that started the recording jumps to the trace.
+ * Exits of the trace that are still open are backpatched by their trampolines
+ * as usual.
+ * @param tld pointer to thread local data
+ * @param tc the trace cache
+ */
+static void finish_trace(struct thread_local_data *tld,
+                         struct trace_cache *tc) {
+  PRINT_DEBUG_FUNCTION_START("finish_trace(*tld=%p, head=%p, blocks=%d)", tld,
+                             tc->head, tc->nr_blocks);
+  Code *start = tc->code;
+  Code *entry = tc->head_trampo->origin;
+
+  fbt_ccache_add_entry(tld, tc->head, start);
+  fbt_ccache_close_fragment(tld, start, tc->end, tc->orig_start,
+                            tc->orig_end);
+
+  *((int32_t*)entry) = (int32_t)((ulong_t)start - (ulong_t)entry - 4);
+  fbt_trampoline_free(tld, tc->head_trampo);
+
+  tc->head_trampo = NULL;
+  tc->head = NULL;
+  tc->code = tc->end;
+  PRINT_DEBUG_FUNCTION_END("-> %p (len: %d)", start, tc->code - start);
+}
+
+/**
+ * Translates a block to the end of the recorded trace.
+ * @param tld pointer to thread local data
+ * @param tc the trace cache
+ * @param orig start of the block in the original program
+ * @return the translated block
+ */
+static void *record_block(struct thread_local_data *tld,
+                          struct trace_cache *tc, void *orig) {
+  struct translate *ts = &(tld->trans);
+  Code *transl_instr = ts->transl_instr;
+  Code *code_cache_end = ts->code_cache_end;
+  Code *block = tc->end;
+
+  ts->transl_instr = block;
+  ts->code_cache_end = tc->code_end - TRANSL_GUARD;
+  ts->in_trace = 1;
+  ts->orig_start = tc->orig_start;
+  ts->orig_end = tc->orig_end;
+#if defined(TIERED_TRANSLATION)
+  /* traces are hot code, translate them with all optimizations */
+  ts->tier = 1;
+#endif  /* TIERED_TRANSLATION */
+  fbt_translate_unit(tld, orig);
+#if defined(TIERED_TRANSLATION)
+  ts->tier = 0;
+#endif  /* TIERED_TRANSLATION */
+  ts->in_trace = 0;
+  tc->orig_start = ts->orig_start;
+  tc->orig_end = ts->orig_end;
+  tc->end = ts->transl_instr;
+  ts->transl_instr = transl_instr;
+  ts->code_cache_end = code_cache_end;
+
+  tc->last_block = orig;
+  tc->nr_blocks++;
+  PRINT_DEBUG("trace %p: block %d at %p -> %p", tc->head, tc->nr_blocks, orig,
+              block);
+
+  /* nothing to extend if the block ends with a return or an indirect jump */
+  if (tail_trampoline(tld, tc) == NULL) {
+    finish_trace(tld, tc);
+  }
+  return block;
+}
+
+/**
+ * Starts the recording of a trace once a counter stub got hot.
+ * @param tld pointer to thread local data
+ * @param tc the trace cache
+ * @param trampo trampoline of the counter stub
+ * @return the code that is executed next
+ */
+static void *start_trace(struct thread_local_data *tld, struct trace_cache *tc,
+                         struct trampoline *trampo) {
+  Code *entry = trampo->origin;
+  void *transl_head = fbt_ccache_find(tld, trampo->target);
+
+  if (PTR_IN_REGION(transl_head, tc->base, tc->code_end - tc->base) ||
+      tc->code_end - tc->code < MAX_BLOCK_SIZE + TRANSL_GUARD) {
+    /* another counter stub recorded a trace for this head already or the trace
+       cache is full, the stub jumps to the head directly from now on */
+    if (transl_head == NULL) {
+      transl_head = fbt_translate_noexecute(tld, trampo->target);
+    }
+    *((int32_t*)entry) = (int32_t)((ulong_t)transl_head - (ulong_t)entry - 4);
+    fbt_trampoline_free(tld, trampo);
+    return transl_head;
+  }
+
+  tc->head_trampo = trampo;
+  tc->head = trampo->target;
+  tc->nr_blocks = 0;
+  tc->end = tc->code;
+  tc->orig_start = tc->orig_end = tc->head;
+  return record_block(tld, tc, tc->head);
+}
+
+/**
+ * Extends the recorded trace with the target of its last exit.
+ * @param tld pointer to thread local data
+ * @param tc the trace cache
+ * @param trampo the trampoline of the last exit
+ * @return the code that is executed next, or NULL if the trace is finished and
+ * the trampoline is handled as usual
+ */
+static void *extend_trace(struct thread_local_data *tld, struct trace_cache *tc,
+                          struct trampoline *trampo) {
+  Code *origin = trampo->origin;
+  void *target = trampo->target;
+
+  if (target == tc->head) {
+    /* the path returns to the head, the trace becomes a loop */
+    Code *start = tc->code;
+    *((int32_t*)origin) = (int32_t)((ulong_t)start - (ulong_t)origin - 4);
+    fbt_trampoline_free(tld, trampo);
+    finish_trace(tld, tc);
+    return start;
+  }
+
+  void *transl_target = fbt_ccache_find(tld, target);
+  if (target <= tc->last_block || tc->nr_blocks >= TRACE_MAX_BLOCKS ||
+      tc->code_end - tc->end < MAX_BLOCK_SIZE + TRANSL_GUARD ||
+      PTR_IN_REGION(transl_target, tc->base, tc->code_end - tc->base)) {
+    /* backward jumps and other traces end the trace */
+    finish_trace(tld, tc);
+    return NULL;
+  }
+
+  if (origin != tc->end - 4) {
+    /* the branch of the jcc is taken: invert the condition and let the jcc
+       branch to the trampoline of the fall through path instead */
+    struct trampoline *fallthru = tail_trampoline(tld, tc);
+    origin[-1] ^= 0x01;
+    *((int32_t*)origin) = (int32_t)((ulong_t)(fallthru->code) -
+                                    (ulong_t)origin - 4);
+    fallthru->origin = origin;
+  }
+
+  /* drop the last jump, the target follows right here */
+  tc->end -= 5;
+  fbt_trampoline_free(tld, trampo);
+  return record_block(tld, tc, target);
+}
+
+void *fbt_trace_head(struct thread_local_data *tld, void *head,
+                     void *transl_head) {
+  struct trace_cache *tc = tld->traces;
+  if (tc == NULL) {
+    tc = allocate_trace_cache(tld);
+  }
+
+  if (PTR_IN_REGION(transl_head, tc->base, tc->code_end - tc->base) ||
+      tc->stubs + TRACE_STUB_SIZE > tc->base + TRACE_CACHE_PAGES * PAGESIZE ||
+      tc->counters == tc->counters_end) {
+    return transl_head;
+  }
+
+  ulong_t *counter = tc->counters++;
+  *counter = TRACE_THRESHOLD;
+
+  Code *stub = tc->stubs;
+  Code *code = stub;
+  struct trampoline *trampo = fbt_create_trampoline(tld, head, stub + 1,
+                                                    ORIGIN_TRACE);
+
+  /* the first jump is redirected to the trace once it is recorded, we must not
+     change the flags in the stub */
+  JMP_REL32(code, (ulong_t)(stub + 5));
+  BEGIN_ASM(code)
+    movl %ecx, {&(tc->scratch)}
+    movl {counter}, %ecx
+    leal -1(%ecx), %ecx
+    movl %ecx, {counter}
+    jecxz hot
+    movl {&(tc->scratch)}, %ecx
+    jmp_abs {transl_head}
+  hot:
+    movl {&(tc->scratch)}, %ecx
+    jmp_abs {trampo->code}
+  END_ASM
+
+  assert(code - stub <= TRACE_STUB_SIZE);
+  tc->stubs = code;
+  PRINT_DEBUG("counter stub for %p at %p", head, stub);
+  return stub;
+}
+
+void *fbt_trace_trampoline(struct thread_local_data *tld,
+                           struct trampoline *trampo) {
+  struct trace_cache *tc = tld->traces;
+  if (tc == NULL) {
+    return NULL;
+  }
+
+  if (trampo->origin_t == ORIGIN_TRACE) {
+    if (tc->head_trampo != NULL) {
+      finish_trace(tld, tc);
+    }
+    return start_trace(tld, tc, trampo);
+  }
+
+  if (tc->head_trampo == NULL) {
+    return NULL;
+  }
+  if (is_tail_exit(tld, tc, trampo)) {
+    return extend_trace(tld, tc, trampo);
+  }
+
+  /* the path left the trace */
+  finish_trace(tld, tc);
+  return NULL;
+}
+
+#endif  /* HOT_TRACES */
@@ -20,6 +20,7 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
  * MA  02110-1301, USA.
  */
+#include <assert.h>
 #include <stddef.h> /* offsetof */
 
 #include "../fbt_trampoline.h"
@@ -29,6 +30,7 @@
 #include "../fbt_translate.h"
 #include "../fbt_mem_mgmt.h"
 #include "../fbt_syscall.h"
+#include "../fbt_trace.h"
 #include "../generic/fbt_libc.h"
 #include "../generic/fbt_llio.h"
 #include "fbt_asm_macros.h"
@@ -65,6 +67,24 @@ static void initialize_ijump_trampoline(struct thread_local_data *tld);
  */
 static void initialize_icall_trampoline(struct thread_local_data *tld);
 
+#if defined(TARGET_REG_LOOKUP)
+/**
+ * Initializes the variants of a lookup trampoline for targets that are in a
+ * register (see action_jmp_indirect). The variants probe the mapping table
+ * with the register itself, so only %ebx is saved around the lookup. A miss
+ * continues in the slow path of the regular trampoline.
+ * @param tld thread local data.
+ * @param variants receives the variants (indexed by the number of the register,
+ * NULL for %ebx and %esp).
+ * @param flags CACHE_LOOKUP_POPFL if the flags are saved below the target.
+ * @param miss miss path of the regular trampoline (after its first lookup),
+ * expects the target in %ecx, the index into the mapping table in %ebx and
+ * [old %ecx] [old %ebx] on the stack.
+ */
+static void initialize_reg_lookup_trampolines(struct thread_local_data *tld,
+                                              void **variants, long flags,
+                                              void *miss);
+#endif  /* TARGET_REG_LOOKUP */
 
 /**
  * Initializes the return trampoline that does a fast table lookup and
@@ -81,9 +101,28 @@ static void initialize_ret_trampolines(struct thread_local_data *tld);
 static void initialize_sysenter_trampoline(struct thread_local_data *tld);
 
 #if defined(ICF_PREDICT)
-/** max number of mispredictions before we rewrite the prediction into a fast
-    lookup. */
+/** max number of mispredictions with a full chain of cached targets before we
+    rewrite the prediction into a fast lookup. */
 #define ICF_PREDICT_MAX_MISPREDICTIONS 20
+/** number of hits that make up for one misprediction */
+#define ICF_PREDICT_DECAY_HITS 64
+/** executions of a megamorphic transfer between two samples (initially) */
+#define ICF_PREDICT_SAMPLE_PERIOD 0x1000
+/** max executions of a megamorphic transfer between two samples */
+#define ICF_PREDICT_MAX_SAMPLE_PERIOD 0x100000
+/** number of consecutive targets that are recorded per sample. If they fit into
+    the chain then the prediction is re-armed. */
+#define ICF_PREDICT_SAMPLE_WINDOW 32
+
+/** an entry of the chain of cached targets */
+struct icf_entry {
+  ulong_t origin;
+  ulong_t dst;
+  ulong_t hits;
+#if defined(FLAG_LIVENESS)
+  long flags_dead;
+#endif  /* FLAG_LIVENESS */
+};
 
 /**
  * Initializes the indirect jump fixup trampoline that fixes a misprediction of
@@ -101,7 +140,8 @@ static void initialize_icall_predict_fixup(struct thread_local_data *tld);
 
 /**
  * This function fixes a wrong prediction and updates the cache. The current
- * (missed) target is added to the top of the cache.
+ * (missed) target is added to the cache. Targets of megamorphic transfers are
+ * handed to icf_predict_sample.
  * @param tld thread local data.
  * @param icf_predict pointer to the prediction struct.
  * @param target pointer to the new target of the indirect control flow
@@ -111,8 +151,89 @@ static void initialize_icall_predict_fixup(struct thread_local_data *tld);
 static void *icf_predict_fixup(struct thread_local_data *tld,
                                struct icf_prediction *icf_predict,
                                void *target);
+
+/**
+ * Collects the used entries of the chain of a prediction, ordered by their
+ * number of hits.
+ * @param icf_predict pointer to the prediction struct.
+ * @param target the target that is added to the chain (or NULL).
+ * @param entries array of ICF_PREDICT_WAYS entries that receives the chain.
+ * @return number of used entries or -1 if target is in the chain already.
+ */
+static long icf_predict_collect(struct icf_prediction *icf_predict,
+                                void *target, struct icf_entry *entries);
+
+/**
+ * Writes a list of entries to the chain of a prediction, unused entries are
+ * cleared.
+ * @param icf_predict pointer to the prediction struct.
+ * @param entries the new entries of the chain.
+ * @param nrentries number of entries.
+ */
+static void icf_predict_rewrite(struct icf_prediction *icf_predict,
+                                struct icf_entry *entries, long nrentries);
+
+/**
+ * Handles a target of a megamorphic transfer: starts a profiling window or
+ * records the target in the current window. If all targets of the window fit
+ * into the chain then the prediction is re-armed.
+ * @param icf_predict pointer to the prediction struct.
+ * @param target the target of the indirect control flow transfer.
+ * @param transl translated version of target.
+ */
+static void icf_predict_sample(struct icf_prediction *icf_predict,
+                               void *target, void *transl);
 #endif  /* ICF_PREDICT */
 
+#if defined(RET_CACHE)
+/** max number of entries that are filled into the return cache of a ret
+    instruction. Afterwards misses go to the regular lookup. */
+#define RET_CACHE_MAX_FILLS (4 * RET_CACHE_ENTRIES)
+
+/**
+ * Initializes the trampoline that fills in an entry of the return cache of a
+ * ret instruction after a miss.
+ * @param tld thread local data.
+ */
+static void initialize_ret_cache_fixup(struct thread_local_data *tld);
+
+/**
+ * Translates the target of a ret instruction and fills it into the return
+ * cache of the ret instruction. If the return cache had too many misses then
+ * further misses go to opt_ret_trampoline.
+ * @param tld thread local data.
+ * @param cache the return cache of the ret instruction.
+ * @param target the return address.
+ * @return pointer to the translated version of the target parameter.
+ */
+static void *ret_cache_fixup(struct thread_local_data *tld,
+                             struct ret_cache *cache, void *target);
+#endif  /* RET_CACHE */
+
+#if defined(PLT_CHAINING)
+/** the GOT entry of a PLT stub may change this often before the stub uses the
+    regular lookup */
+#define PLT_MAX_FIXES 4
+
+/**
+ * Initializes the trampoline that fills in the target of a PLT guard.
+ * @param tld thread local data.
+ */
+static void initialize_plt_fixup(struct thread_local_data *tld);
+
+/**
+ * Translates the target of a PLT stub and links the guard of the stub to it.
+ * If the GOT entry changed too often then further misses go to
+ * opt_ijump_trampoline.
+ * @param tld thread local data.
+ * @param guard the guard of the PLT stub.
+ * @param target the value of the GOT entry.
+ * @return pointer to the translated version of the target parameter.
+ */
+static void *plt_fixup(struct thread_local_data *tld, struct plt_guard *guard,
+                       void *target);
+#endif  /* PLT_CHAINING */
+
 #if defined(HANDLE_SIGNALS)
 /**
  * This trampoline is used for internal signals: we can compare the
@@ -149,6 +270,9 @@ enum ASM_CACHE_LOOKUP_FLAGS {
   CACHE_LOOKUP_POPFL = 1
 };
 
+/** register argument of asm_cache_lookup if the target is in %ebx */
+#define LOOKUP_REG_NONE -1
+
 #define ASM_FAST_CACHE_LOOKUP(target, query, index) \
   BEGIN_ASM(target) \
   /* A cache hit at this point might be a superficial miss (i.e. there exists \
@@ -156,9 +280,9 @@ enum ASM_CACHE_LOOKUP_FLAGS {
    * We therefore scan the code cache to make sure there doesn't already exist \
    * an entry, before jumping into the binary translator. */ \
     loop: \
-      cmpl {tld->mappingtable}(, index, 8), query \
+      cmpl {tld->mappingtable->table}(, index, 8), query \
       je hit \
-      cmp $0, {tld->mappingtable}(, index, 8) \
+      cmp $0, {tld->mappingtable->table}(, index, 8) \
       je nohit_fallback \
       incl index \
       jmp loop \
@@ -166,18 +290,112 @@ enum ASM_CACHE_LOOKUP_FLAGS {
     nohit_fallback:     \
   END_ASM
 
+#if MAPPINGTABLE_BUCKET_NRBITS != 6
+#error ASM_CACHE_TEST assumes buckets of 8 entries
+#endif
 #define ASM_CACHE_TEST(addr, target) \
-    /* Use special hash pattern (unshifted) to get offset right */ \
-    andl ${MAPPING_PATTERN >> 3}, addr; \
+    /* Index of the first entry in the bucket (the byte offset of \
+     * C_MAPPING_FUNCTION divided by the size of an entry) */ \
+    shll $3, addr; \
+    andl ${MAPPING_PATTERN(tld->mappingtable->size) >> 3}, addr; \
     /* Load hashline (eip element) */ \
-    cmpl {tld->mappingtable}(, addr, 8), target; \
+    cmpl {tld->mappingtable->table}(, addr, 8), target; \
 
 #define SWITCH_TO_SECURED_STACK \
-    movl %esp, {tld->stack-1}; \
-    movl ${tld->stack-1}, %esp;
+    movl %esp, TLD_STACK(tld, 1); \
+    MOVL_TLD_STACK_ESP(tld, 1);
 
 #define SWITCH_TO_USER_STACK \
-    movl {tld->stack-1}, %esp;
+    movl TLD_STACK(tld, 1), %esp;
+
+/* Removes the flags that were saved below the target of an indirect jump and
+   the target from the stack, the flags are restored without popfl if
+   FLAG_LIVENESS is enabled. */
+#if defined(FLAG_LIVENESS)
+#define POP_FLAGS_AND_TARGET \
+    ASM_RESTORE_FLAGS \
+    leal 8(%esp), %esp;
+#else
+#define POP_FLAGS_AND_TARGET \
+    popfl; \
+    leal 4(%esp), %esp;
+#endif  /* FLAG_LIVENESS */
+
+#if defined(SHARED_CODE_CACHE)
+/**
+ * Translates a target for the lookup trampolines. The lookup itself does not
+ * lock the shared code cache, the translation does.
+ * @param tld thread local data.
+ * @param target pointer to the untranslated code.
+ * @return pointer to the translated code.
+ */
+static void *translate_noexecute_locked(struct thread_local_data *tld,
+                                        void *target) {
+  fbt_lock_code_cache(tld);
+  void *transl = fbt_translate_noexecute(tld, target);
+  fbt_unlock_code_cache(tld);
+  return transl;
+}
+#define TRANSLATE_NOEXECUTE translate_noexecute_locked
+#elif defined(CCACHE_EVICTION)
+/**
+ * Translates a target for the lookup trampolines. The lookup trampolines are
+ * entered with a jump, so this is a safe point to evict parts of the code
+ * cache.
+ * @param tld thread local data.
+ * @param target pointer to the untranslated code.
+ * @return pointer to the translated code.
+ */
+static void *translate_noexecute_evict(struct thread_local_data *tld,
+                                       void *target) {
+  fbt_ccache_evict(tld);
+  return fbt_translate_noexecute(tld, target);
+}
+#define TRANSLATE_NOEXECUTE translate_noexecute_evict
+#else
+#define TRANSLATE_NOEXECUTE fbt_translate_noexecute
+#endif  /* SHARED_CODE_CACHE */
+
+/**
+ * Emits the entry of a lookup trampoline. When the mapping table grows the
+ * lookup trampolines are generated anew and the entry of the first generation
+ * is redirected to them (see fbt_update_lookup_trampolines). With a shared code
+ * cache other threads might run through the entry while we redirect it, so the
+ * entry is a jmp to the next instruction with an aligned displacement that we
+ * rewrite with a single store.
+ * @param transl_instr where the trampoline starts
+ * @param entry returns the address of the trampoline
+ * @return first byte after the entry
+ */
+static unsigned char *emit_lookup_entry(unsigned char *transl_instr,
+                                        void **entry) {
+#if defined(SHARED_CODE_CACHE)
+  while (((ulong_t)transl_instr + 1) & 0x3) {
+    *transl_instr++ = 0x90;  /* nop */
+  }
+  *entry = transl_instr;
+  JMP_REL32(transl_instr, transl_instr + 5);
+#else
+  *entry = transl_instr;
+#endif  /* SHARED_CODE_CACHE */
+  return transl_instr;
+}
+
+/**
+ * Redirects the entry of a lookup trampoline to a new lookup trampoline.
+ * @param entry entry of the old trampoline
+ * @param target the new trampoline
+ */
+static void redirect_lookup_entry(void *entry, void *target) {
+#if defined(SHARED_CODE_CACHE)
+  *(volatile int32_t*)(entry + 1) = (int32_t)(target - (entry + 5));
+#else
+  /* the thread that grows the table is the only one that uses the
+     trampolines, so we can overwrite the first instructions */
+  unsigned char *code = entry;
+  JMP_REL32(code, target);
+#endif  /* SHARED_CODE_CACHE */
+}
 
  /** Generates machine code that performs a cache sweep, after we encounter the
   * 'nohit' case. This allows as to avoid jumping into the libdetox context
@@ -199,28 +417,45 @@ enum ASM_CACHE_LOOKUP_FLAGS {
   * If not, the control falls through to the instruction after the code
   * generated by asm_cache_lookup
   *
+  * If reg is not LOOKUP_REG_NONE then the target is in the register with
+  * that number instead of %ecx, only %ebx is overwritten and only [old %ebx]
+  * is on the stack.
+  *
   * @param  tld Thread-local data
   * @param  transl_instr Address to the memory to which the machine code will
             be written
+  * @param  flags CACHE_LOOKUP_POPFL if the flags are saved below the target
+  * @param  reg number of the register that holds the target (or
+            LOOKUP_REG_NONE)
   * @return One byte after the last byte that was written
   */
 static unsigned char *asm_cache_lookup(struct thread_local_data *tld,
                                        unsigned char *transl_instr,
-                                       long flags) {
+                                       long flags, long reg) {
   /* The reason that we use JNE_I8 instead of label support in the DSL, is
    * this allows us to more easily generate machine code that has modular
    * components in it, as the DSL needs to know at compile time how long
    * our machine code is.
    */
 
-  BEGIN_ASM(transl_instr)
-    // Duplicate RIP
-    movl %ebx, %ecx
-  END_ASM
+  if (reg == LOOKUP_REG_NONE) {
+    BEGIN_ASM(transl_instr)
+      // Duplicate RIP
+      movl %ebx, %ecx
+    END_ASM
 
-  BEGIN_ASM(transl_instr)
-    ASM_CACHE_TEST(%ebx, %ecx)
-  END_ASM
+    BEGIN_ASM(transl_instr)
+      ASM_CACHE_TEST(%ebx, %ecx)
+    END_ASM
+  } else {
+    BEGIN_ASM(transl_instr)
+      shll $3, %ebx
+      andl ${MAPPING_PATTERN(tld->mappingtable->size) >> 3}, %ebx
+    END_ASM
+    /* cmpl table(, %ebx, 8), reg */
+    CMPL_R32_IMM32RM32SIB(transl_instr, 0x04 | (reg << 3), 0xdd,
+                          (int32_t)tld->mappingtable->table);
+  }
 
   /* Hit or no hit? jump if ecx is 0 */
   /***********************************/
@@ -234,24 +469,32 @@ static unsigned char *asm_cache_lookup(struct thread_local_data *tld,
   BEGIN_ASM(transl_instr)
   hit:
     // Load target
-    movl {tld->mappingtable+4}(, %ebx, 8), %ebx
+    movl {tld->mappingtable->table+4}(, %ebx, 8), %ebx
 
-    movl %ebx, {&tld->ind_target}
-    popl %ecx
-    popl %ebx
+    movl %ebx, TLD_FIELD(tld, ind_target)
   END_ASM
 
-  if (flags & CACHE_LOOKUP_POPFL) {
+  if (reg == LOOKUP_REG_NONE) {
     BEGIN_ASM(transl_instr)
-      popfl
+      popl %ecx
     END_ASM
   }
-
   BEGIN_ASM(transl_instr)
-    leal 4(%esp), %esp
-    jmp *{&tld->ind_target}
+    popl %ebx
   END_ASM
 
+  if (flags & CACHE_LOOKUP_POPFL) {
+    BEGIN_ASM(transl_instr)
+      POP_FLAGS_AND_TARGET
+      jmp *TLD_FIELD(tld, ind_target)
+    END_ASM
+  } else {
+    BEGIN_ASM(transl_instr)
+      leal 4(%esp), %esp
+      jmp *TLD_FIELD(tld, ind_target)
+    END_ASM
+  }
+
   /* recover mode - there was no hit! */
   /************************************/
   *hitloc = (char)(((int32_t)transl_instr)-(((int32_t)hitloc)+1));
@@ -268,17 +511,22 @@ static unsigned char *asm_cache_lookup(struct thread_local_data *tld,
    * We therefore scan the code cache to make sure there doesn't already exist
    * an entry, before jumping into the binary translator. */
   unsigned char *label_loop = transl_instr;
-  BEGIN_ASM(transl_instr)
-    loop:
-      cmpl %ecx, {tld->mappingtable}(, %ebx, 8)
-  END_ASM
+  if (reg == LOOKUP_REG_NONE) {
+    BEGIN_ASM(transl_instr)
+      loop:
+        cmpl %ecx, {tld->mappingtable->table}(, %ebx, 8)
+    END_ASM
+  } else {
+    CMPL_R32_IMM32RM32SIB(transl_instr, 0x04 | (reg << 3), 0xdd,
+                          (int32_t)tld->mappingtable->table);
+  }
 
 
   /* Hash table hit: goto 'hit' label */
   JE_I8(transl_instr, (char)((long)label_hit - (long)transl_instr - 2));
 
   BEGIN_ASM(transl_instr)
-      cmp $0, {tld->mappingtable}(, %ebx, 8)
+      cmp $0, {tld->mappingtable->table}(, %ebx, 8)
   END_ASM
 
   /* We encounter a zero entry: jump to 'nohit_fallback' */
@@ -300,6 +548,7 @@ static unsigned char *asm_cache_lookup(struct thread_local_data *tld,
 }
 
 void fbt_initialize_trampolines(struct thread_local_data *tld) {
+  fbt_lock_code_cache(tld);
   initialize_unmanaged_code_trampoline(tld);
   initialize_ret2app_trampoline(tld);
   initialize_ijump_trampoline(tld);
@@ -309,6 +558,12 @@ void fbt_initialize_trampolines(struct thread_local_data *tld) {
   initialize_icall_predict_fixup(tld);
 #endif  /* ICF_PREDICT */
   initialize_ret_trampolines(tld);
+#if defined(RET_CACHE)
+  initialize_ret_cache_fixup(tld);
+#endif  /* RET_CACHE */
+#if defined(PLT_CHAINING)
+  initialize_plt_fixup(tld);
+#endif  /* PLT_CHAINING */
   initialize_sysenter_trampoline(tld);
 
 #if defined(AUTHORIZE_SYSCALLS)
@@ -319,7 +574,231 @@ void fbt_initialize_trampolines(struct thread_local_data *tld) {
   initialize_signal_trampoline(tld);
   initialize_bootstrap_thread_trampoline(tld);
 #endif /* HANDLE_SIGNALS */
+  fbt_unlock_code_cache(tld);
+}
+
+#if defined(SHARED_CODE_CACHE)
+void fbt_inherit_trampolines(struct thread_local_data *tld,
+                             struct thread_local_data *parent) {
+  tld->unmanaged_code_trampoline = parent->unmanaged_code_trampoline;
+  tld->ret2app_trampoline = parent->ret2app_trampoline;
+  tld->opt_ijump_trampoline = parent->opt_ijump_trampoline;
+  tld->opt_icall_trampoline = parent->opt_icall_trampoline;
+#if defined(TARGET_REG_LOOKUP)
+  fbt_memcpy(tld->opt_ijump_reg_trampoline, parent->opt_ijump_reg_trampoline,
+             sizeof(tld->opt_ijump_reg_trampoline));
+  fbt_memcpy(tld->opt_icall_reg_trampoline, parent->opt_icall_reg_trampoline,
+             sizeof(tld->opt_icall_reg_trampoline));
+#endif  /* TARGET_REG_LOOKUP */
+#if defined(ICF_PREDICT)
+  tld->opt_ijump_predict_fixup = parent->opt_ijump_predict_fixup;
+  tld->opt_icall_predict_fixup = parent->opt_icall_predict_fixup;
+#endif  /* ICF_PREDICT */
+  tld->opt_ret_trampoline = parent->opt_ret_trampoline;
+  tld->opt_ret_remove_trampoline = parent->opt_ret_remove_trampoline;
+  tld->sysenter_trampoline = parent->sysenter_trampoline;
+  tld->int80_trampoline = parent->int80_trampoline;
+#if defined(HANDLE_SIGNALS)
+  tld->signal_trampoline = parent->signal_trampoline;
+
+  /* the bootstrap trampoline is private to the thread, it lives in a page
+     that is freed when the thread exits */
+  tld->trans.transl_instr = fbt_lalloc(tld, 1, MT_TRAMPOLINE);
+  initialize_bootstrap_thread_trampoline(tld);
+  tld->trans.transl_instr = NULL;
+#endif  /* HANDLE_SIGNALS */
+}
+#endif  /* SHARED_CODE_CACHE */
+
+void fbt_update_lookup_trampolines(struct thread_local_data *tld) {
+  /* translated code and the other trampolines jump to the first generation of
+     the lookup trampolines, so we keep those pointers and redirect them */
+  void *ijump = tld->opt_ijump_trampoline;
+  void *icall = tld->opt_icall_trampoline;
+  void *ret_remove = tld->opt_ret_remove_trampoline;
+#if defined(TRAMPOLINE_FAST_PATH)
+  void *unmanaged = tld->unmanaged_code_trampoline;
+#endif  /* TRAMPOLINE_FAST_PATH */
+#if defined(TARGET_REG_LOOKUP)
+  void *ijump_reg[8], *icall_reg[8];
+  long reg;
+  fbt_memcpy(ijump_reg, tld->opt_ijump_reg_trampoline, sizeof(ijump_reg));
+  fbt_memcpy(icall_reg, tld->opt_icall_reg_trampoline, sizeof(icall_reg));
+#endif  /* TARGET_REG_LOOKUP */
+  unsigned char *transl_instr = tld->trans.transl_instr;
+
+  /* the current position in the code cache might belong to a TU */
+  unsigned char *page = fbt_shared_lalloc(tld, 1, MT_CODE_CACHE);
+  tld->trans.transl_instr = page;
+  initialize_ijump_trampoline(tld);
+  initialize_icall_trampoline(tld);
+  initialize_ret_trampolines(tld);
+#if defined(TRAMPOLINE_FAST_PATH)
+  initialize_unmanaged_code_trampoline(tld);
+#endif  /* TRAMPOLINE_FAST_PATH */
+  assert(tld->trans.transl_instr < page + PAGESIZE);
+  PRINT_DEBUG("regenerated lookup trampolines for mappingtable %p\n",
+              tld->mappingtable->table);
+
+  redirect_lookup_entry(ijump, tld->opt_ijump_trampoline);
+  redirect_lookup_entry(icall, tld->opt_icall_trampoline);
+  redirect_lookup_entry(ret_remove, tld->opt_ret_remove_trampoline);
+#if defined(TARGET_REG_LOOKUP)
+  for (reg = 0; reg < 8; ++reg) {
+    if (ijump_reg[reg] != NULL) {
+      redirect_lookup_entry(ijump_reg[reg], tld->opt_ijump_reg_trampoline[reg]);
+      redirect_lookup_entry(icall_reg[reg], tld->opt_icall_reg_trampoline[reg]);
+    }
+  }
+  fbt_memcpy(tld->opt_ijump_reg_trampoline, ijump_reg, sizeof(ijump_reg));
+  fbt_memcpy(tld->opt_icall_reg_trampoline, icall_reg, sizeof(icall_reg));
+#endif  /* TARGET_REG_LOOKUP */
+#if defined(TRAMPOLINE_FAST_PATH)
+  redirect_lookup_entry(unmanaged, tld->unmanaged_code_trampoline);
+  tld->unmanaged_code_trampoline = unmanaged;
+#endif  /* TRAMPOLINE_FAST_PATH */
+
+  tld->opt_ijump_trampoline = ijump;
+  tld->opt_icall_trampoline = icall;
+  tld->opt_ret_trampoline = icall;
+  tld->opt_ret_remove_trampoline = ret_remove;
+  tld->trans.transl_instr = transl_instr;
+}
+
+#if defined(TRAMPOLINE_FAST_PATH)
+/** jne/je to the slow path of the fast path below, the offset is filled in
+    once the slow path is emitted (it is too far away for an 8 bit offset) */
+#define JNE_SLOW(dst) *dst++ = 0x0f; *dst++ = 0x85; slow[nr_slow++] = dst; \
+  dst += 4
+#define JE_SLOW(dst) *dst++ = 0x0f; *dst++ = 0x84; slow[nr_slow++] = dst; \
+  dst += 4
+
+/**
+ * Emits the fast path of the unmanaged code trampoline. If the target of a
+ * trampoline of a relative jump is translated already (i.e., another jump was
+ * linked to it) and the target is found in the first slot of its bucket in the
+ * mapping table then the fast path backpatches the jump, frees the trampoline
+ * and jumps to the translated target without switching to the C code of the
+ * BT. All other cases fall through to the full context switch (the slow path),
+ * restoring the registers that the fast path used.
+ * The fast path bakes in the mapping table and is therefore generated anew
+ * together with the lookup trampolines (see fbt_update_lookup_trampolines).
+ * @param tld thread local data
+ * @param transl_instr where the fast path starts
+ * @return first byte after the fast path (the start of the slow path)
+ */
+static unsigned char *emit_trampoline_fast_path(struct thread_local_data *tld,
+                                                unsigned char *transl_instr) {
+  /* the rip that is pushed by the call in the trampoline points to the origin
+     field of the trampoline, the other fields are addressed relative to it */
+  const long origin = offsetof(struct trampoline, origin);
+  unsigned char *slow[6];
+  long nr_slow = 0;
+
+  BEGIN_ASM(transl_instr)
+    pushfl
+    pushl %ebx
+    pushl %ecx
+  END_ASM
+
+#if defined(HOT_TRACES)
+  /* every trampoline might end the recording of a trace */
+  BEGIN_ASM(transl_instr)
+    movl {&tld->traces}, %ecx
+    testl %ecx, %ecx
+  END_ASM
+  JE_I8(transl_instr, 0x0);
+  unsigned char *no_traces = transl_instr - 1;
+  BEGIN_ASM(transl_instr)
+    cmpl $0x0, {offsetof(struct trace_cache, head_trampo)}(%ecx)
+  END_ASM
+  JNE_SLOW(transl_instr);
+  *no_traces = (unsigned char)(transl_instr - (no_traces + 1));
+#endif  /* HOT_TRACES */
+
+  /* only relative jumps that were not removed in the meantime (the trampoline
+     of the last jump of a TU that is continued in place has no origin) */
+  BEGIN_ASM(transl_instr)
+    movl 12(%esp), %ecx
+    cmpl ${ORIGIN_RELATIVE}, {offsetof(struct trampoline, origin_t) - origin}(%ecx)
+  END_ASM
+  JNE_SLOW(transl_instr);
+  BEGIN_ASM(transl_instr)
+    cmpl $0x0, (%ecx)
+  END_ASM
+  JE_SLOW(transl_instr);
+#if defined(EAGER_BACKPATCHING)
+  /* a trampoline whose target was translated without linking it (e.g., as a
+     trace or in the second tier) is still in the table of pending
+     trampolines, fbt_trampoline_free removes it from there */
+  BEGIN_ASM(transl_instr)
+    cmpl ${(ulong_t)TRAMPOLINE_UNTRACKED}, {offsetof(struct trampoline, pending) - origin}(%ecx)
+  END_ASM
+  JNE_SLOW(transl_instr);
+#endif  /* EAGER_BACKPATCHING */
+#if defined(TRAMPOLINE_SHARING)
+  /* the other jumps of a shared trampoline are linked in C as well (see
+     fbt_link_shared_origins) */
+  BEGIN_ASM(transl_instr)
+    cmpl $0x0, {offsetof(struct trampoline, origins) - origin}(%ecx)
+  END_ASM
+  JNE_SLOW(transl_instr);
+#endif  /* TRAMPOLINE_SHARING */
+
+  /* is the target translated? */
+  BEGIN_ASM(transl_instr)
+    movl {offsetof(struct trampoline, target) - origin}(%ecx), %ebx
+    movl %ebx, %ecx
+    ASM_CACHE_TEST(%ebx, %ecx)
+  END_ASM
+  JNE_SLOW(transl_instr);
+
+  BEGIN_ASM(transl_instr)
+    movl {tld->mappingtable->table+4}(, %ebx, 8), %ebx
+    movl %ebx, TLD_FIELD(tld, ind_target)
+
+    // backpatch the jump (*origin = transl - origin - 4)
+    movl 12(%esp), %ecx
+    movl (%ecx), %ecx
+    subl %ecx, %ebx
+    leal -4(%ebx), %ebx
+    movl %ebx, (%ecx)
+
+    // free the trampoline (see fbt_trampoline_free)
+    movl 12(%esp), %ecx
+    leal {-origin}(%ecx), %ecx
+    movl {&tld->trans.trampos}, %ebx
+    movl %ebx, {offsetof(struct trampoline, next)}(%ecx)
+    movl $0x0, {origin}(%ecx)
+    movl %ecx, {&tld->trans.trampos}
+
+    popl %ecx
+    popl %ebx
+    popfl
+
+    // remove rip from trampoline
+    leal 4(%esp), %esp
+
+    // restore esp to original stack frame
+    popl %esp
+
+    jmp *TLD_FIELD(tld, ind_target)
+  END_ASM
+
+  /* slow path */
+  while (nr_slow > 0) {
+    unsigned char *loc = slow[--nr_slow];
+    *((int32_t*)loc) = (int32_t)(transl_instr - (loc + 4));
+  }
+  BEGIN_ASM(transl_instr)
+    popl %ecx
+    popl %ebx
+    popfl
+  END_ASM
+
+  return transl_instr;
 }
+#endif  /* TRAMPOLINE_FAST_PATH */
 
 static void initialize_unmanaged_code_trampoline(struct thread_local_data *tld) {
   unsigned char *transl_instr = tld->trans.transl_instr;
@@ -345,6 +824,9 @@ static void initialize_unmanaged_code_trampoline(struct thread_local_data *tld)
    *   movl tld->stack-1, %esp
    *   call tld->unmanaged_code_trampoline
    */
+#if defined(TRAMPOLINE_FAST_PATH)
+  transl_instr = emit_trampoline_fast_path(tld, transl_instr);
+#endif  /* TRAMPOLINE_FAST_PATH */
   BEGIN_ASM(transl_instr)
     // save flags & registers
     pushfl
@@ -352,9 +834,9 @@ static void initialize_unmanaged_code_trampoline(struct thread_local_data *tld)
 
     // push target trampoline (second argument)
     pushl 36(%esp)
-    addl $-16, (%esp)
+    addl $-TRAMPOLINE_CODE_LEN, (%esp)
     // push pointer to thread local data (first argument)
-    pushl ${tld}
+    PUSHL_TLD(tld)
     // needs to figure out and free trampoline
     call_abs {translate_execute}
 
@@ -371,7 +853,7 @@ static void initialize_unmanaged_code_trampoline(struct thread_local_data *tld)
     // restore esp to original stack frame
     popl %esp
 
-    jmp *{&tld->ind_target}
+    jmp *TLD_FIELD(tld, ind_target)
   END_ASM
 
   /* forward pointer */
@@ -390,7 +872,7 @@ static void initialize_ret2app_trampoline(struct thread_local_data *tld) {
     pushl $0x0
     // Adjust %esp
     leal 4(%esp), %esp
-    jmp *({&tld->ind_target})
+    jmp *TLD_FIELD(tld, ind_target)
   END_ASM
 
   /* forward pointer */
@@ -399,6 +881,52 @@ static void initialize_ret2app_trampoline(struct thread_local_data *tld) {
 
 static void translate_execute(struct thread_local_data *tld,
                               struct trampoline *trampo) {
+  fbt_lock_code_cache(tld);
+#if defined(EAGER_BACKPATCHING)
+  /* this trampoline is backpatched and freed below */
+  fbt_untrack_trampoline(tld, trampo);
+#endif  /* EAGER_BACKPATCHING */
+#if defined(HOT_TRACES)
+  /* counter stubs and the exits of a trace that is being recorded */
+  void *trace = fbt_trace_trampoline(tld, trampo);
+  if (trace != NULL) {
+    tld->ind_target = trace;
+    fbt_unlock_code_cache(tld);
+    return;
+  }
+#endif  /* HOT_TRACES */
+#if defined(TIERED_TRANSLATION)
+  if (trampo->origin_t == ORIGIN_TIER) {
+    /* the counter of a fragment of the first tier has expired */
+    tld->ind_target = fbt_translate_tier1(tld, trampo);
+    fbt_unlock_code_cache(tld);
+    return;
+  }
+#endif  /* TIERED_TRANSLATION */
+#if defined(JUMP_TABLES)
+  if (trampo->origin_t == ORIGIN_JUMP_TABLE) {
+    /* an entry of a jump table is used for the first time */
+    struct jump_table *jt = (struct jump_table*)trampo->origin;
+    ulong_t index = tld->jump_table_index;
+    tld->ind_target = fbt_translate_noexecute(tld, (void*)jt->table[index]);
+    /* the table might have been given up in the meantime */
+    if (jt->transl[index] == jt->fill) {
+      jt->transl[index] = tld->ind_target;
+    }
+    fbt_unlock_code_cache(tld);
+    return;
+  }
+#endif  /* JUMP_TABLES */
+#if defined(CCACHE_EVICTION)
+  Code *origin = trampo->origin;
+  fbt_ccache_evict(tld);
+  if (origin != NULL && trampo->origin == NULL) {
+    /* the jump that led here was evicted and the trampoline is free already */
+    tld->ind_target = fbt_translate_noexecute(tld, trampo->target);
+    fbt_unlock_code_cache(tld);
+    return;
+  }
+#endif  /* CCACHE_EVICTION */
   void *transl_addr = fbt_ccache_find(tld, trampo->target);
 
   if (transl_addr == NULL) {
@@ -419,6 +947,10 @@ static void translate_execute(struct thread_local_data *tld,
   /* use a jump-back trampoline to jump to the translated code in the code
      cache */
   tld->ind_target = transl_addr;
+#if defined(TRAMPOLINE_SHARING)
+  /* the other jumps that share this trampoline */
+  fbt_link_shared_origins(tld, trampo, transl_addr);
+#endif  /* TRAMPOLINE_SHARING */
 
   /* do we need to backpatch the newly translated code (e.g. remove the jump to
      the trampoline and redirect the control flow transfer to the newly
@@ -435,18 +967,40 @@ static void translate_execute(struct thread_local_data *tld,
       case ORIGIN_ABSOLUTE:
         *origin = (uint32_t)(transl_addr);
         break;
+#if defined(SHADOW_STACK)
+      case ORIGIN_SHADOW:
+        *origin = (uint32_t)(transl_addr);
+        break;
+#endif  /* SHADOW_STACK */
       default:
         fbt_suicide_str("Illegal origin in trampoline (fbt_trampoline.c).\n");
     }
-    /* free trampoline if we were able to backpatch*/
+#if defined(CCACHE_EVICTION)
+    if (trampo->origin_t != ORIGIN_CLEAR) {
+      fbt_ccache_add_link(tld, origin, trampo->origin_t);
+    }
+#endif  /* CCACHE_EVICTION */
+#if !defined(SHARED_CODE_CACHE)
+    /* free trampoline if we were able to backpatch (a shared trampoline is
+       never freed, other threads might still be on their way into it) */
+#if defined(SHADOW_STACK)
+    if (trampo->origin_t != ORIGIN_SHADOW)
+#endif  /* SHADOW_STACK */
     fbt_trampoline_free(tld, trampo);
+#endif  /* !SHARED_CODE_CACHE */
   }
+#if defined(BATCH_TRANSLATION)
+  /* translate the targets of other new jumps while we are here */
+  fbt_translate_speculative(tld);
+#endif  /* BATCH_TRANSLATION */
+  fbt_unlock_code_cache(tld);
 }
 
 static void initialize_ijump_trampoline(struct thread_local_data *tld) {
-  unsigned char *transl_instr = tld->trans.transl_instr;
-  tld->opt_ijump_trampoline = (void*)transl_instr;
-  PRINT_DEBUG("indirect jump trampoline is at %p\n", transl_instr);
+  unsigned char *transl_instr =
+    emit_lookup_entry(tld->trans.transl_instr, &tld->opt_ijump_trampoline);
+  PRINT_DEBUG("indirect jump trampoline is at %p\n",
+              tld->opt_ijump_trampoline);
 
   /* Generate trampoline:
    *   pushl $target - this is done in the CC
@@ -456,7 +1010,8 @@ static void initialize_ijump_trampoline(struct thread_local_data *tld) {
    *   pushl  %ecx
    *   movl   12(%esp), %ebx      # load target
    *   movl   %ebx, %ecx          # duplicate rip
-   *   andl   MAPPING_PATTERN, %ebx  # hash function
+   *   shll   $3, %ebx            # hash function (first entry of the bucket)
+   *   andl   MAPPING_PATTERN, %ebx
    *   cmpl   mappingtable_start(0, %ebx, 8), %ecx
    *   jne    nohit
    *
@@ -503,7 +1058,11 @@ static void initialize_ijump_trampoline(struct thread_local_data *tld) {
   INCL_M64(transl_instr, (int32_t)&fbt_nr_ind_jump);
 #endif
 
-  transl_instr = asm_cache_lookup(tld, transl_instr, CACHE_LOOKUP_POPFL);
+  transl_instr = asm_cache_lookup(tld, transl_instr, CACHE_LOOKUP_POPFL,
+                                  LOOKUP_REG_NONE);
+#if defined(TARGET_REG_LOOKUP)
+  unsigned char *miss = transl_instr;
+#endif  /* TARGET_REG_LOOKUP */
 
   /* recover mode - there was no hit! */
   /************************************/
@@ -514,41 +1073,46 @@ static void initialize_ijump_trampoline(struct thread_local_data *tld) {
 #endif
 
   BEGIN_ASM(transl_instr)
-    movl %ecx, {tld->stack-1} // target
+    movl %ecx, TLD_STACK(tld, 1) // target
 
     popl %ecx
     popl %ebx
 
     // now left on stack: FLAGS and target
     // switch to secured stack
-    movl %esp, {tld->stack-2}
-    movl ${tld->stack-2}, %esp
+    movl %esp, TLD_STACK(tld, 2)
+    MOVL_TLD_STACK_ESP(tld, 2)
     pusha
 
     pushl 36(%esp) // target
-    pushl ${tld}
-    call_abs {&fbt_translate_noexecute}
+    PUSHL_TLD(tld)
+    call_abs {&TRANSLATE_NOEXECUTE}
 
-    movl %eax, {&tld->ind_target}
+    movl %eax, TLD_FIELD(tld, ind_target)
     leal 8(%esp), %esp
 
     popa
     popl %esp
-    popfl
 
-    // Now left on stack: target
-    leal 4(%esp), %esp
-    jmp *{&tld->ind_target}
+    // Now left on stack: FLAGS and target
+    POP_FLAGS_AND_TARGET
+    jmp *TLD_FIELD(tld, ind_target)
   END_ASM
 
   /* forward pointer */
   tld->trans.transl_instr = transl_instr;
+
+#if defined(TARGET_REG_LOOKUP)
+  initialize_reg_lookup_trampolines(tld, tld->opt_ijump_reg_trampoline,
+                                    CACHE_LOOKUP_POPFL, miss);
+#endif  /* TARGET_REG_LOOKUP */
 }
 
 static void initialize_icall_trampoline(struct thread_local_data *tld) {
-  unsigned char *transl_instr = tld->trans.transl_instr;
-  tld->opt_icall_trampoline = (void*)transl_instr;
-  PRINT_DEBUG("indirect call trampoline is at %p\n", transl_instr);
+  unsigned char *transl_instr =
+    emit_lookup_entry(tld->trans.transl_instr, &tld->opt_icall_trampoline);
+  PRINT_DEBUG("indirect call trampoline is at %p\n",
+              tld->opt_icall_trampoline);
 
   /* this trampoline is basically the same as ijump but without pushfl */
 
@@ -563,14 +1127,18 @@ static void initialize_icall_trampoline(struct thread_local_data *tld) {
     movl %ebx, %ecx // Duplicate RIP
   END_ASM
 
-  transl_instr = asm_cache_lookup(tld, transl_instr, CACHE_LOOKUP_NONE);
+  transl_instr = asm_cache_lookup(tld, transl_instr, CACHE_LOOKUP_NONE,
+                                  LOOKUP_REG_NONE);
+#if defined(TARGET_REG_LOOKUP)
+  unsigned char *miss = transl_instr;
+#endif  /* TARGET_REG_LOOKUP */
 
 #if defined(FBT_STATISTIC)
   INCL_M64(transl_instr, (int32_t)&fbt_nr_ind_call_miss);
 #endif
 
   BEGIN_ASM(transl_instr)
-    movl %ecx, {tld->stack-1} // target is still in %ecx
+    movl %ecx, TLD_STACK(tld, 1) // target is still in %ecx
     popl %ecx
     popl %ebx
 
@@ -578,35 +1146,102 @@ static void initialize_icall_trampoline(struct thread_local_data *tld) {
     leal 4(%esp), %esp
 
     // Switch to secured stack
-    movl %esp, {tld->stack-2}
-    movl ${tld->stack-2}, %esp
+    movl %esp, TLD_STACK(tld, 2)
+    MOVL_TLD_STACK_ESP(tld, 2)
 
     pusha
     pushl 36(%esp) // target
-    pushl ${tld}
+    PUSHL_TLD(tld)
 
-    call_abs {&fbt_translate_noexecute}
+    call_abs {&TRANSLATE_NOEXECUTE}
 
-    movl %eax, {&tld->ind_target}
+    movl %eax, TLD_FIELD(tld, ind_target)
     leal 8(%esp), %esp
     popa
 
     popl %esp // restore esp (to original stack frame)
-    jmp *{&tld->ind_target}
+    jmp *TLD_FIELD(tld, ind_target)
   END_ASM
 
   /* forward pointer */
   tld->trans.transl_instr = transl_instr;
+
+#if defined(TARGET_REG_LOOKUP)
+  initialize_reg_lookup_trampolines(tld, tld->opt_icall_reg_trampoline,
+                                    CACHE_LOOKUP_NONE, miss);
+#endif  /* TARGET_REG_LOOKUP */
 }
 
+#if defined(TARGET_REG_LOOKUP)
+static void initialize_reg_lookup_trampolines(struct thread_local_data *tld,
+                                              void **variants, long flags,
+                                              void *miss) {
+  long reg;
+  for (reg = 0; reg < 8; ++reg) {
+    /* %ebx (3) is the index of the lookup and %esp (4) never holds a target */
+    if (reg == 3 || reg == 4) {
+      variants[reg] = NULL;
+      continue;
+    }
+    unsigned char *transl_instr =
+      emit_lookup_entry(tld->trans.transl_instr, &variants[reg]);
+
+    /* Generate trampoline (for reg = %eax):
+     *   pushl $target - this is done in the CC
+     * ==== that's where we start ====
+     *   pushfl                     # only for indirect jumps
+     *   pushl  %ebx
+     *   movl   %eax, %ebx
+     *   shll   $3, %ebx            # hash function (first entry of the bucket)
+     *   andl   MAPPING_PATTERN, %ebx
+     *   cmpl   mappingtable_start(0, %ebx, 8), %eax
+     *   jne    nohit
+     *   ... (as in initialize_ijump_trampoline but without %ecx)
+     * nohit:
+     *   pushl  %ecx
+     *   movl   %eax, %ecx
+     *   jmp    miss
+     */
+    if (flags & CACHE_LOOKUP_POPFL) {
+      BEGIN_ASM(transl_instr)
+        pushfl
+      END_ASM
+    }
+    BEGIN_ASM(transl_instr)
+      pushl %ebx
+    END_ASM
+    /* movl reg, %ebx */
+    MOVL_R32_RM32(transl_instr, 0xc3 | (reg << 3));
+
+    transl_instr = asm_cache_lookup(tld, transl_instr, flags, reg);
+
+    /* restore the state of the regular trampoline after its lookup */
+    BEGIN_ASM(transl_instr)
+      pushl %ecx
+    END_ASM
+    if (reg != 1) {
+      /* movl reg, %ecx */
+      MOVL_R32_RM32(transl_instr, 0xc1 | (reg << 3));
+    }
+    BEGIN_ASM(transl_instr)
+      jmp_abs {miss}
+    END_ASM
+
+    tld->trans.transl_instr = transl_instr;
+  }
+}
+#endif  /* TARGET_REG_LOOKUP */
+
 static void initialize_ret_trampolines(struct thread_local_data *tld) {
   /* we use the same trampoline as for indirect calls */
   tld->opt_ret_trampoline = tld->opt_icall_trampoline;
 
   /* special trampoline that removes a couple of bytes from the stack */
-  unsigned char *transl_instr = tld->trans.transl_instr;
-  tld->opt_ret_remove_trampoline = (void*)transl_instr;
-  PRINT_DEBUG("(removing) ret trampoline is at %p\n", transl_instr);
+  unsigned char *transl_instr =
+    emit_lookup_entry(tld->trans.transl_instr,
+                      &tld->opt_ret_remove_trampoline);
+  PRINT_DEBUG("(removing) ret trampoline is at %p\n",
+              tld->opt_ret_remove_trampoline);
 
   /* this trampoline is basically the same as ijump but without pushfl and
      the addition that we pop additional bytes from the stack */
@@ -619,7 +1254,8 @@ static void initialize_ret_trampolines(struct thread_local_data *tld) {
    *   pushl  %ecx
    *   movl   12(%esp), %ebx      # load target
    *   movl   %ebx, %ecx          # duplicate rip
-   *   andl   MAPPING_PATTERN, %ebx  # hash function
+   *   shll   $3, %ebx            # hash function (first entry of the bucket)
+   *   andl   MAPPING_PATTERN, %ebx
    *   cmpl   mappingtable_start(0, %ebx, 8), %ecx
    *   jne    nohit
    *
@@ -676,15 +1312,15 @@ static void initialize_ret_trampolines(struct thread_local_data *tld) {
   /**************************************************/
   BEGIN_ASM(transl_instr)
     // Load target
-    movl {tld->mappingtable+4}(, %ebx, 8), %ebx
+    movl {tld->mappingtable->table+4}(, %ebx, 8), %ebx
 
-    movl %ebx, {&tld->ind_target}
+    movl %ebx, TLD_FIELD(tld, ind_target)
     popl %ecx
     popl %ebx
     addl (%esp), %esp
     leal 8(%esp), %esp
 
-    jmp *{&tld->ind_target}
+    jmp *TLD_FIELD(tld, ind_target)
   END_ASM
 
   /* recover mode - there was no hit! */
@@ -698,7 +1334,7 @@ static void initialize_ret_trampolines(struct thread_local_data *tld) {
 #endif
 
   BEGIN_ASM(transl_instr)
-    movl %ecx, {tld->stack-10} // target is still in %ecx
+    movl %ecx, TLD_STACK(tld, 10) // target is still in %ecx
     popl %ecx
     popl %ebx
 
@@ -710,17 +1346,17 @@ static void initialize_ret_trampolines(struct thread_local_data *tld) {
 
     pusha
       leal -4(%esp), %esp  // skip over target
-    pushl ${tld}
+    PUSHL_TLD(tld)
 
-    call_abs {&fbt_translate_noexecute}
+    call_abs {&TRANSLATE_NOEXECUTE}
 
-    movl %eax, {&tld->ind_target}
+    movl %eax, TLD_FIELD(tld, ind_target)
 
     leal 8(%esp), %esp
     popa
 
     popl %esp
-    jmp *{&tld->ind_target}
+    jmp *TLD_FIELD(tld, ind_target)
   END_ASM
 
   /* forward pointer */
@@ -775,7 +1411,7 @@ static void initialize_sysenter_trampoline(struct thread_local_data *tld) {
     pushl %ecx
     pushl %ebx
     pushl %eax
-    pushl ${tld}
+    PUSHL_TLD(tld)
 
     // ensure that eax is in range
     andl ${MAX_SYSCALLS_TABLE-1}, %eax
@@ -858,22 +1494,21 @@ static void initialize_ijump_predict_fixup(struct thread_local_data *tld) {
     SWITCH_TO_SECURED_STACK
     pusha
     // load and push target
-    movl {tld->stack-1}, %ebx
+    movl TLD_STACK(tld, 1), %ebx
     movl 4(%ebx), %ebx
     pushl %ebx
     // jump over icf_target pushed before (in trampoline)
     leal -4(%esp), %esp
-    pushl ${tld}
+    PUSHL_TLD(tld)
 
     call_abs {&icf_predict_fixup}
-    movl %eax, {&tld->ind_target}
+    movl %eax, TLD_FIELD(tld, ind_target)
     leal 12(%esp), %esp
 
     popa
     popl %esp
-    popfl
-    leal 4(%esp), %esp
-    jmp *{&tld->ind_target}
+    POP_FLAGS_AND_TARGET
+    jmp *TLD_FIELD(tld, ind_target)
 
   END_ASM
 
@@ -896,22 +1531,21 @@ static void initialize_icall_predict_fixup(struct thread_local_data *tld) {
     SWITCH_TO_SECURED_STACK
     pusha
     // load and push target
-    movl {tld->stack-1}, %ebx
+    movl TLD_STACK(tld, 1), %ebx
     movl 4(%ebx), %ebx
     pushl %ebx
     // jump over icf_target pushed before (in trampoline)
     leal -4(%esp), %esp
-    pushl ${tld}
+    PUSHL_TLD(tld)
 
     call_abs {&icf_predict_fixup}
-    movl %eax, {&tld->ind_target}
+    movl %eax, TLD_FIELD(tld, ind_target)
     leal 12(%esp), %esp
 
     popa
     popl %esp
-    popfl
-    leal 4(%esp), %esp
-    jmp *{&tld->ind_target}
+    POP_FLAGS_AND_TARGET
+    jmp *TLD_FIELD(tld, ind_target)
   END_ASM
 
   /* forward pointer */
@@ -925,26 +1559,344 @@ static void *icf_predict_fixup(struct thread_local_data *tld,
               target, icf_predict);
   //llprintf("Fixing prediction (for ICF) to %p (info at %p), \n",
   //            target, icf_predict);
+  fbt_lock_code_cache(tld);
+#if defined(CCACHE_EVICTION)
+  fbt_ccache_evict(tld);
+  if (icf_predict->origin[0] == NULL) {
+    /* the prediction lived in an evicted part of the code cache */
+    void *transl = fbt_translate_noexecute(tld, target);
+    fbt_unlock_code_cache(tld);
+    return transl;
+  }
+#endif  /* CCACHE_EVICTION */
   void *transl = fbt_translate_noexecute(tld, target);
-  /* origin is a pointer into the code cache */
-  *(icf_predict->origin1) = ((ulong_t)target);
-  /* dst is a pointer into the code cache */
-  *(icf_predict->dst1) = ((ulong_t)transl - (ulong_t)(icf_predict->dst1) - 4);
 
-  icf_predict->nrmispredict++;
+  if (icf_predict->state != ICF_PREDICTING) {
+    icf_predict_sample(icf_predict, target, transl);
+    fbt_unlock_code_cache(tld);
+    return transl;
+  }
+
+  /* correct predictions since the last rewrite make up for mispredictions,
+     so that a phase with many targets is forgotten over time */
+  ulong_t hits = 0;
+  long i;
+  for (i = 0; i < ICF_PREDICT_WAYS; ++i) {
+    hits += icf_predict->hits[i];
+  }
+  ulong_t forgiven = (hits - icf_predict->nrhits) / ICF_PREDICT_DECAY_HITS;
+  if (forgiven >= icf_predict->nrmispredict) {
+    icf_predict->nrmispredict = 0;
+  } else {
+    icf_predict->nrmispredict -= forgiven;
+  }
+
+  struct icf_entry entries[ICF_PREDICT_WAYS];
+  long nrentries = icf_predict_collect(icf_predict, target, entries);
+  if (nrentries < 0) {
+    /* another thread added the target already */
+    fbt_unlock_code_cache(tld);
+    return transl;
+  }
+  /* old hits count less than new ones */
+  for (i = 0; i < nrentries; ++i) {
+    entries[i].hits /= 2;
+  }
+
+  /* the new target replaces the least frequent one if the chain is full */
+  if (nrentries == ICF_PREDICT_WAYS) {
+    nrentries--;
+    icf_predict->nrmispredict++;
+  }
+  entries[nrentries].origin = (ulong_t)target;
+  entries[nrentries].dst = (ulong_t)transl;
+  entries[nrentries].hits = 0;
+#if defined(FLAG_LIVENESS)
+  entries[nrentries].flags_dead = fbt_flags_dead(target);
+#endif  /* FLAG_LIVENESS */
+  nrentries++;
+  icf_predict_rewrite(icf_predict, entries, nrentries);
 
   if (icf_predict->nrmispredict >= ICF_PREDICT_MAX_MISPREDICTIONS) {
+    /* the transfer is megamorphic, use the stub with the regular lookup */
+    PRINT_DEBUG("prediction at %p is megamorphic\n", icf_predict->pred.src);
+    if (icf_predict->period == 0) {
+      icf_predict->period = ICF_PREDICT_SAMPLE_PERIOD;
+    }
+    icf_predict->countdown = icf_predict->period;
+    icf_predict->state = ICF_MEGAMORPHIC;
     unsigned char* transl_addr = (unsigned char*)icf_predict->pred.src;
     BEGIN_ASM(transl_addr)
-      jmp_abs {tld->opt_ijump_trampoline}
+      jmp_abs {icf_predict->megamorphic}
     END_ASM
-
-    fbt_icf_predictor_free(tld, icf_predict);
   }
+  fbt_unlock_code_cache(tld);
   return transl;
 }
+
+static long icf_predict_collect(struct icf_prediction *icf_predict,
+                                void *target, struct icf_entry *entries) {
+  long nrentries = 0;
+  long i, j;
+  for (i = 0; i < ICF_PREDICT_WAYS; ++i) {
+    ulong_t origin = *(icf_predict->origin[i]);
+    if (origin == 0x0) {
+      continue;
+    }
+    if (origin == (ulong_t)target) {
+      return -1;
+    }
+    ulong_t hits = icf_predict->hits[i];
+    for (j = nrentries; j > 0 && entries[j-1].hits < hits; --j) {
+      entries[j] = entries[j-1];
+    }
+    entries[j].origin = origin;
+    entries[j].dst = (ulong_t)(icf_predict->dst[i]) + 4 +
+      *(icf_predict->dst[i]);
+    entries[j].hits = hits;
+#if defined(FLAG_LIVENESS)
+    entries[j].flags_dead = (icf_predict->restore[i][0] !=
+                             icf_predict->restore_code[0]);
+#endif  /* FLAG_LIVENESS */
+    nrentries++;
+  }
+  return nrentries;
+}
+
+static void icf_predict_rewrite(struct icf_prediction *icf_predict,
+                                struct icf_entry *entries, long nrentries) {
+  /* other threads might run through the prediction right now, make sure that
+     they never see a new origin together with an old destination */
+  long i;
+  for (i = 0; i < ICF_PREDICT_WAYS; ++i) {
+    *(icf_predict->origin[i]) = 0x0;
+    icf_predict->hits[i] = 0;
+  }
+#if defined(SHARED_CODE_CACHE)
+  __sync_synchronize();
+#endif  /* SHARED_CODE_CACHE */
+  icf_predict->nrhits = 0;
+  for (i = 0; i < nrentries; ++i) {
+    /* dst is a pointer into the code cache */
+    *(icf_predict->dst[i]) = (entries[i].dst - (ulong_t)(icf_predict->dst[i]) -
+                              4);
+    icf_predict->hits[i] = entries[i].hits;
+    icf_predict->nrhits += entries[i].hits;
+#if defined(FLAG_LIVENESS)
+    /* a hit on a target with dead flags jumps over the restore of the flags */
+    unsigned char *restore = icf_predict->restore[i];
+    if (entries[i].flags_dead) {
+      JMP_I8(restore, icf_predict->restore_len - 2);
+    } else {
+      restore[0] = icf_predict->restore_code[0];
+      restore[1] = icf_predict->restore_code[1];
+    }
+#endif  /* FLAG_LIVENESS */
+  }
+#if defined(SHARED_CODE_CACHE)
+  __sync_synchronize();
+#endif  /* SHARED_CODE_CACHE */
+  for (i = 0; i < nrentries; ++i) {
+    /* origin is a pointer into the code cache */
+    *(icf_predict->origin[i]) = entries[i].origin;
+  }
+}
+
+static void icf_predict_sample(struct icf_prediction *icf_predict,
+                               void *target, void *transl) {
+  struct icf_entry entries[ICF_PREDICT_WAYS];
+  long i;
+  /* the chain is not executed while the transfer is megamorphic, we use it to
+     record the targets of the profiling window */
+  if (icf_predict->state == ICF_MEGAMORPHIC) {
+    icf_predict_rewrite(icf_predict, entries, 0);
+    icf_predict->nrsamples = 0;
+    icf_predict->state = ICF_PROFILING;
+  }
+
+  for (i = 0; i < ICF_PREDICT_WAYS; ++i) {
+    if (*(icf_predict->origin[i]) == (ulong_t)target) {
+      icf_predict->hits[i]++;
+      break;
+    }
+  }
+  if (i == ICF_PREDICT_WAYS) {
+    long nrentries = icf_predict_collect(icf_predict, target, entries);
+    if (nrentries == ICF_PREDICT_WAYS) {
+      /* still megamorphic, take samples less often */
+      if (icf_predict->period < ICF_PREDICT_MAX_SAMPLE_PERIOD) {
+        icf_predict->period *= 2;
+      }
+      icf_predict->countdown = icf_predict->period;
+      icf_predict->state = ICF_MEGAMORPHIC;
+      return;
+    }
+    entries[nrentries].origin = (ulong_t)target;
+    entries[nrentries].dst = (ulong_t)transl;
+    entries[nrentries].hits = 1;
+#if defined(FLAG_LIVENESS)
+    entries[nrentries].flags_dead = fbt_flags_dead(target);
+#endif  /* FLAG_LIVENESS */
+    icf_predict_rewrite(icf_predict, entries, nrentries + 1);
+  }
+
+  if (++icf_predict->nrsamples < ICF_PREDICT_SAMPLE_WINDOW) {
+    /* record the next target as well */
+    icf_predict->countdown = 1;
+    return;
+  }
+
+  /* the transfer is stable again, re-arm the chain ordered by the hits of the
+     window and restore the first compare that was overwritten by the jump to
+     the megamorphic stub */
+  long nrentries = icf_predict_collect(icf_predict, NULL, entries);
+  icf_predict_rewrite(icf_predict, entries, nrentries);
+  icf_predict->nrmispredict = 0;
+  icf_predict->state = ICF_PREDICTING;
+  icf_predict->nrrearms++;
+  PRINT_DEBUG("prediction at %p is re-armed with %d targets\n",
+              icf_predict->pred.src, nrentries);
+#if defined(SHARED_CODE_CACHE)
+  __sync_synchronize();
+#endif  /* SHARED_CODE_CACHE */
+  unsigned char* transl_addr = (unsigned char*)icf_predict->pred.src;
+  BEGIN_ASM(transl_addr)
+    pushfl
+    cmpl ${entries[0].origin}, 4(%esp)
+  END_ASM
+}
 #endif  /* ICF_PREDICT */
 
+#if defined(RET_CACHE)
+static void initialize_ret_cache_fixup(struct thread_local_data *tld) {
+  unsigned char *transl_instr = tld->trans.transl_instr;
+  tld->opt_ret_cache_fixup = (void*)transl_instr;
+  PRINT_DEBUG("return cache fixup is at %p\n", transl_instr);
+
+  /* Stack before trampoline:
+   * return address
+   * pointer to the ret_cache struct that must be updated is stored to
+   * tld->stack-12
+   */
+
+  BEGIN_ASM(transl_instr)
+    SWITCH_TO_SECURED_STACK
+    pushfl
+    pusha
+    // load and push return address
+    movl TLD_STACK(tld, 1), %ebx
+    movl (%ebx), %ebx
+    pushl %ebx
+    // jump over ret_cache pushed before (in the ret instruction)
+    leal -4(%esp), %esp
+    PUSHL_TLD(tld)
+
+    call_abs {&ret_cache_fixup}
+    movl %eax, TLD_FIELD(tld, ind_target)
+    leal 12(%esp), %esp
+
+    popa
+    popfl
+    popl %esp
+    leal 4(%esp), %esp
+    jmp *TLD_FIELD(tld, ind_target)
+  END_ASM
+
+  /* forward pointer */
+  tld->trans.transl_instr = transl_instr;
+}
+
+static void *ret_cache_fixup(struct thread_local_data *tld,
+                             struct ret_cache *cache, void *target) {
+  PRINT_DEBUG("Filling return cache %p with %p\n", cache, target);
+  fbt_lock_code_cache(tld);
+#if defined(CCACHE_EVICTION)
+  fbt_ccache_evict(tld);
+  if (cache->miss == NULL) {
+    /* the ret instruction lived in an evicted part of the code cache */
+    void *transl = fbt_translate_noexecute(tld, target);
+    fbt_unlock_code_cache(tld);
+    return transl;
+  }
+#endif  /* CCACHE_EVICTION */
+  void *transl = fbt_translate_noexecute(tld, target);
+
+  ulong_t i = (ulong_t)target & (RET_CACHE_ENTRIES - 1);
+  cache->entries[i].ret = (ulong_t)target;
+  cache->entries[i].transl = transl;
+
+  if (++cache->nrfills == RET_CACHE_MAX_FILLS) {
+    /* the return addresses conflict, use the regular lookup */
+    PRINT_DEBUG("return cache %p conflicts, using the lookup\n", cache);
+    *(uint32_t*)(cache->miss) = (uint32_t)((ulong_t)tld->opt_ret_trampoline -
+                                           (ulong_t)cache->miss - 4);
+  }
+  fbt_unlock_code_cache(tld);
+  return transl;
+}
+#endif  /* RET_CACHE */
+
+#if defined(PLT_CHAINING)
+static void initialize_plt_fixup(struct thread_local_data *tld) {
+  unsigned char *transl_instr = tld->trans.transl_instr;
+  tld->opt_plt_fixup = (void*)transl_instr;
+  PRINT_DEBUG("PLT fixup is at %p\n", transl_instr);
+
+  /* Stack before trampoline:
+   * return address
+   * target (the value of the GOT entry)
+   * pointer to the plt_guard struct that must be updated is stored to
+   * tld->stack-12
+   */
+
+  BEGIN_ASM(transl_instr)
+    SWITCH_TO_SECURED_STACK
+    pushfl
+    pusha
+    // load and push target
+    movl TLD_STACK(tld, 1), %ebx
+    movl (%ebx), %ebx
+    pushl %ebx
+    // jump over plt_guard pushed before (in the PLT stub)
+    leal -4(%esp), %esp
+    PUSHL_TLD(tld)
+
+    call_abs {&plt_fixup}
+    movl %eax, TLD_FIELD(tld, ind_target)
+    leal 12(%esp), %esp
+
+    popa
+    popfl
+    popl %esp
+    leal 4(%esp), %esp
+    jmp *TLD_FIELD(tld, ind_target)
+  END_ASM
+
+  /* forward pointer */
+  tld->trans.transl_instr = transl_instr;
+}
+
+static void *plt_fixup(struct thread_local_data *tld, struct plt_guard *guard,
+                       void *target) {
+  PRINT_DEBUG("PLT guard %p gets target %p\n", guard, target);
+  fbt_lock_code_cache(tld);
+  void *transl = fbt_translate_noexecute(tld, target);
+
+  if (++guard->nrfixes <= PLT_MAX_FIXES) {
+    *(guard->expected) = -(ulong_t)target;
+    *(uint32_t*)(guard->hit) = (uint32_t)((ulong_t)transl -
+                                          (ulong_t)guard->hit - 4);
+  } else {
+    /* the GOT entry keeps changing, use the regular lookup */
+    PRINT_DEBUG("PLT guard %p is unstable, using the lookup\n", guard);
+    *(uint32_t*)(guard->miss) = (uint32_t)((ulong_t)tld->opt_ijump_trampoline -
+                                           (ulong_t)guard->miss - 4);
+  }
+  fbt_unlock_code_cache(tld);
+  return transl;
+}
+#endif  /* PLT_CHAINING */
+
 #if defined(AUTHORIZE_SYSCALLS)
 static void initialize_int80_trampoline(struct thread_local_data *tld) {
   unsigned char *transl_instr = tld->trans.transl_instr;
@@ -969,7 +1921,7 @@ static void initialize_int80_trampoline(struct thread_local_data *tld) {
     pushl %ecx
     pushl %ebx
     pushl %eax
-    pushl ${tld}
+    PUSHL_TLD(tld)
 
     // Ensure that eax is in range
     andl ${MAX_SYSCALLS_TABLE-1}, %eax
@@ -1002,7 +1954,7 @@ static void initialize_int80_trampoline(struct thread_local_data *tld) {
     // Restore original stack
     popl %esp
 
-    jmp *{&tld->ind_target}
+    jmp *TLD_FIELD(tld, ind_target)
 
   auth_granted:
 
@@ -1010,7 +1962,7 @@ static void initialize_int80_trampoline(struct thread_local_data *tld) {
     popl %esp
 
     int $0x80
-    jmp *{&tld->ind_target}
+    jmp *TLD_FIELD(tld, ind_target)
 
 
   END_ASM
@@ -1041,12 +1993,21 @@ static void initialize_signal_trampoline(struct thread_local_data *tld) {
     movl 12(%esp), %eax
 
     // Debug
+#if defined(SHARED_CODE_CACHE)
+    pushl TLD_FIELD(tld, stack)
+    popl {offsetof(fbt_siginfo_t, value)}(%eax)
+#else
     movl ${tld}, {offsetof(fbt_siginfo_t, value)}(%eax)
+#endif  /* SHARED_CODE_CACHE */
 
     // Load si_ptr into %eax
     movl {offsetof(fbt_siginfo_t, value)}(%eax), %eax
 
+#if defined(SHARED_CODE_CACHE)
+    cmpl TLD_FIELD(tld, stack), %eax
+#else
     cmpl ${tld}, %eax
+#endif  /* SHARED_CODE_CACHE */
 
     popl %eax
 
@@ -1069,6 +2030,9 @@ static void initialize_signal_trampoline(struct thread_local_data *tld) {
 static void initialize_bootstrap_thread_trampoline(struct thread_local_data *tld) {
   tld->bootstrap_thread_trampoline = tld->trans.transl_instr;
 
+  /* this trampoline runs before the tld segment of the new thread is set up
+     (fbt_bootstrap_thread), so it always uses absolute addresses */
+
   unsigned char *transl_instr = tld->trans.transl_instr;
 
   BEGIN_ASM(transl_instr)
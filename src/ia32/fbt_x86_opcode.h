@@ -268,6 +268,20 @@
 #define		ST7						0x00000087
 
 
+/*******************************************************\
+ * eflags read and written by an instruction           *
+\*******************************************************/
+#define		EFLAGS_CF				0x01
+#define		EFLAGS_PF				0x02
+#define		EFLAGS_AF				0x04
+#define		EFLAGS_ZF				0x08
+#define		EFLAGS_SF				0x10
+#define		EFLAGS_OF				0x20
+#define		EFLAGS_DF				0x40
+#define		EFLAGS_STATUS			0x3F		/* CF, PF, AF, ZF, SF and OF */
+#define		EFLAGS_ALL				0x7F
+
+
 /*******************************************************\
  * instruction flags                                   *
 \*******************************************************/
@@ -441,6 +455,10 @@ struct ia32_opcode {
   const char* mnemonic;
   //#endif
 
+  /* eflags (EFLAGS_*) that are read and that are always overwritten */
+  const unsigned char eflagsRead;
+  const unsigned char eflagsWritten;
+
 };
 
 #endif  /* FBT_X86_OPCODE_H */
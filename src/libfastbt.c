@@ -31,6 +31,9 @@
 #include "fbt_code_cache.h"
 #include "fbt_debug.h"
 #include "fbt_mem_mgmt.h"
+#if defined(PERSISTENT_CCACHE)
+# include "fbt_persistent_cache.h"
+#endif
 #include "fbt_syscall.h"
 #include "fbt_translate.h"
 #include "fbt_trampoline.h"
@@ -132,6 +135,11 @@ struct thread_local_data* fbt_init(ArchOpcode *opcode_table) {
   DUMP_START();
   DEBUG_START();
 
+#if defined(PERSISTENT_CCACHE)
+  /* must happen before the first allocation */
+  fbt_pcache_init();
+#endif  /* PERSISTENT_CCACHE */
+
   struct thread_local_data *tld = fbt_init_tls();
   #ifdef SHARED_DATA
   fbt_init_shared_data(tld);
@@ -152,13 +160,38 @@ struct thread_local_data* fbt_init(ArchOpcode *opcode_table) {
   fbt_init_syscalls(tld);
 #endif
 
+#if defined(PERSISTENT_CCACHE)
+  /* reuse the code cache of the last run (first thread only) */
+  fbt_pcache_load(tld);
+#endif  /* PERSISTENT_CCACHE */
+
+  return tld;
+}
+
+#if defined(SHARED_CODE_CACHE)
+struct thread_local_data *fbt_init_thread(struct thread_local_data *parent) {
+  struct thread_local_data *tld = fbt_init_tls();
+
+  fbt_attach_shared_data(tld, parent->shared_data);
+  fbt_inherit_trampolines(tld, parent);
+
+#if defined(AUTHORIZE_SYSCALLS)
+  /* the syscall table is shared, only set up the signal handlers */
+  fbt_init_syscalls_thread(tld);
+#endif  /* AUTHORIZE_SYSCALLS */
+
   return tld;
 }
+#endif  /* SHARED_CODE_CACHE */
 
 void fbt_exit(struct thread_local_data *tld) {
   PRINT_DEBUG_FUNCTION_START("fbt_exit(tld=%p)\n", tld);
   assert(tld != NULL);
 
+#if defined(PERSISTENT_CCACHE)
+  fbt_pcache_store(tld);
+#endif  /* PERSISTENT_CCACHE */
+
   fbt_mem_free(tld);
 
   PRINT_DEBUG_FUNCTION_END(" ");
@@ -192,11 +225,13 @@ void fbt_start_transaction(struct thread_local_data *tld,
   PRINT_DEBUG_FUNCTION_START("fbt_start_transaction(commit_function = %p)",
                              (void*)commit_function);
 
+  fbt_lock_code_cache(tld);
   fbt_transaction_init(tld, commit_function);
 
   /* find out return instruction pointer (=beginning of first TU)*/
   void *orig_begin = __builtin_return_address(0);
   char *transl_begin = fbt_translate_noexecute(tld, orig_begin);
+  fbt_unlock_code_cache(tld);
 
   PRINT_DEBUG("starting transaction at %p (orig. addr: %p)\n",
               (long)transl_begin, (long)orig_begin);
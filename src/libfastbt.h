@@ -49,6 +49,17 @@ extern "C" {
 __attribute__((visibility("default"))) struct thread_local_data*
 fbt_init(ArchOpcode *opcode_table);
 
+#if defined(SHARED_CODE_CACHE)
+/**
+ * Initializes the binary translator for a new thread that shares the code
+ * cache, the mapping table and the trampolines with its parent.
+ *
+ * @param parent pointer to thread local data of the parent thread
+ * @return pointer to thread local data of the new thread
+ */
+struct thread_local_data *fbt_init_thread(struct thread_local_data *parent);
+#endif  /* SHARED_CODE_CACHE */
+
 /**
  * Shuts the BT down.
  *